@@ -37,6 +37,16 @@ else:
     extra_library_dirs = ['/usr/local/lib']
 
 
+# Calling iconv() with no arguments (as check_func() does) won't compile
+# with its prototype, so look for it by linking a real use of it.
+iconv_code = '''
+int main() {
+    iconv_t cd = iconv_open("UTF-8", "ISO-8859-1");
+    iconv_close(cd);
+    return 0;
+}
+'''.strip()
+
 iconv_inputtype_code = '''
 int main(int argc, const char ** argv) {
     char buf[20];
@@ -60,7 +70,7 @@ class config(du_config):
             pass
 
     def search_libs(self, func, libraries_list, library_dirs_list,
-                    headers=None, include_dirs=None):
+                    headers=None, include_dirs=None, code=None):
         """Search for the libraries needed for func.
 
         Returns None if no set of libraries which provide func are found.
@@ -73,6 +83,10 @@ class config(du_config):
         will be automatically generated (but this may fail to be linkable,
         particularly if the header file uses macro magic to refer to a
         different symbol).
+
+        If code is not None, it is a program using func, which is linked
+        instead of one which just calls func with no arguments (which won't
+        compile if a header declares func with some).
         
         """
         log.info("Searching for library containing %s() ..." % func)
@@ -89,12 +103,20 @@ class config(du_config):
                 decl = False
                 if headers is None:
                     decl = True
-                if self.check_func(func,
-                                   headers=headers,
-                                   include_dirs=include_dirs,
-                                   libraries=libraries,
-                                   library_dirs=library_dirs,
-                                   decl=decl, call=True):
+                if code is not None:
+                    found = self.try_link(code,
+                                          headers=headers,
+                                          include_dirs=include_dirs,
+                                          libraries=libraries,
+                                          library_dirs=library_dirs)
+                else:
+                    found = self.check_func(func,
+                                            headers=headers,
+                                            include_dirs=include_dirs,
+                                            libraries=libraries,
+                                            library_dirs=library_dirs,
+                                            decl=decl, call=True)
+                if found:
                     if lib is None:
                         log.info("... no additional library required for %s()" % func)
                     else:
@@ -198,7 +220,8 @@ class config(du_config):
                                      ('iconv', 'libiconv'),
                                      library_dirs_list,
                                      headers=('iconv.h',),
-                                     include_dirs=iconv_include_dirs)
+                                     include_dirs=iconv_include_dirs,
+                                     code=iconv_code)
         if iconv_lib is None:
             have_iconv = False
             # Doesn't matter what type we use, but might as well be a
@@ -215,6 +238,7 @@ class config(du_config):
 
         have_sys_errno_h = self.check_header("sys/errno.h")
         have_strings_h = self.check_header("strings.h")
+        have_sys_mman_h = self.check_header("sys/mman.h")
 
         self.set_define("PACKAGE",
                         "htmlparser",
@@ -225,6 +249,9 @@ class config(du_config):
         self.set_define("HAVE_STRINGS_H",
                         have_strings_h,
                         "Define to 1 if you have the <strings.h> header file.")
+        self.set_define("HAVE_SYS_MMAN_H",
+                        have_sys_mman_h,
+                        "Define to 1 if you have the <sys/mman.h> header file.")
         self.set_define("USE_ICONV",
                         have_iconv,
                         "Define to 1 if iconv() should be used for converting character sets.")
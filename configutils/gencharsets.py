@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+"""Generate src/charsettables.h and src/charsettables.cc.
+
+These hold tables for converting the common single-byte character sets to
+UTF-8, and a perfect hash of their names.  The names (and which table each
+one uses) follow the WHATWG Encoding Standard, so pages labelled as
+ISO-8859-1 or ASCII are decoded as Windows-1252, as browsers do.  The
+tables are built from Python's codecs (so this script needs Python 3).  Run
+from the top of the source tree:
+
+    python3 configutils/gencharsets.py
+
+"""
+
+import codecs
+import os
+import sys
+
+from perfecthash import generate, format_array
+from genhtmltags import write_file
+
+if sys.version_info[0] < 3:
+    sys.stderr.write("gencharsets.py needs Python 3\n")
+    sys.exit(1)
+
+# Each table, with the Python codec it's built from, and its labels.
+CHARSETS = [
+    ('windows-874', 'cp874',
+     'dos-874 iso-8859-11 iso8859-11 iso885911 tis-620 windows-874'),
+    ('windows-1250', 'cp1250', 'cp1250 windows-1250 x-cp1250'),
+    ('windows-1251', 'cp1251', 'cp1251 windows-1251 x-cp1251'),
+    ('windows-1252', 'cp1252', """
+        ansi_x3.4-1968 ascii cp1252 cp819 csisolatin1 ibm819 iso-8859-1
+        iso-ir-100 iso8859-1 iso88591 iso_8859-1 iso_8859-1:1987 l1 latin1
+        us-ascii windows-1252 x-cp1252"""),
+    ('windows-1253', 'cp1253', 'cp1253 windows-1253 x-cp1253'),
+    ('windows-1254', 'cp1254', """
+        cp1254 csisolatin5 iso-8859-9 iso-ir-148 iso8859-9 iso88599
+        iso_8859-9 iso_8859-9:1989 l5 latin5 windows-1254 x-cp1254"""),
+    ('windows-1255', 'cp1255', 'cp1255 windows-1255 x-cp1255'),
+    ('windows-1256', 'cp1256', 'cp1256 windows-1256 x-cp1256'),
+    ('windows-1257', 'cp1257', 'cp1257 windows-1257 x-cp1257'),
+    ('windows-1258', 'cp1258', 'cp1258 windows-1258 x-cp1258'),
+    ('iso-8859-2', 'iso8859_2', """
+        csisolatin2 iso-8859-2 iso-ir-101 iso8859-2 iso88592 iso_8859-2
+        iso_8859-2:1987 l2 latin2"""),
+    ('iso-8859-3', 'iso8859_3', """
+        csisolatin3 iso-8859-3 iso-ir-109 iso8859-3 iso88593 iso_8859-3
+        iso_8859-3:1988 l3 latin3"""),
+    ('iso-8859-4', 'iso8859_4', """
+        csisolatin4 iso-8859-4 iso-ir-110 iso8859-4 iso88594 iso_8859-4
+        iso_8859-4:1988 l4 latin4"""),
+    ('iso-8859-5', 'iso8859_5', """
+        csisolatincyrillic cyrillic iso-8859-5 iso-ir-144 iso8859-5 iso88595
+        iso_8859-5 iso_8859-5:1988"""),
+    ('iso-8859-6', 'iso8859_6', """
+        arabic asmo-708 csiso88596e csiso88596i csisolatinarabic ecma-114
+        iso-8859-6 iso-8859-6-e iso-8859-6-i iso-ir-127 iso8859-6 iso88596
+        iso_8859-6 iso_8859-6:1987"""),
+    ('iso-8859-7', 'iso8859_7', """
+        csisolatingreek ecma-118 elot_928 greek greek8 iso-8859-7 iso-ir-126
+        iso8859-7 iso88597 iso_8859-7 iso_8859-7:1987 sun_eu_greek"""),
+    ('iso-8859-8', 'iso8859_8', """
+        csiso88598e csiso88598i csisolatinhebrew hebrew iso-8859-8
+        iso-8859-8-e iso-8859-8-i iso-ir-138 iso8859-8 iso88598 iso_8859-8
+        iso_8859-8:1988 logical visual"""),
+    ('iso-8859-10', 'iso8859_10', """
+        csisolatin6 iso-8859-10 iso-ir-157 iso8859-10 iso885910 l6 latin6"""),
+    ('iso-8859-13', 'iso8859_13', 'iso-8859-13 iso8859-13 iso885913'),
+    ('iso-8859-14', 'iso8859_14', 'iso-8859-14 iso8859-14 iso885914'),
+    ('iso-8859-15', 'iso8859_15', """
+        csisolatin9 iso-8859-15 iso8859-15 iso885915 iso_8859-15 l9 latin9"""),
+    ('iso-8859-16', 'iso8859_16', 'iso-8859-16 latin10'),
+    ('koi8-r', 'koi8_r', 'cskoi8r koi koi8 koi8-r koi8_r'),
+    ('koi8-u', 'koi8_u', 'koi8-ru koi8-u'),
+]
+
+HEADER = """/* %(name)s: tables for converting single-byte character sets.
+ *
+ * This file is automatically generated by configutils/gencharsets.py
+ */
+"""
+
+def normalise(label):
+    """Normalise a label as single_byte_charset() does."""
+    label = label.lower()
+    for c in ' -_.':
+        label = label.replace(c, '')
+    return label
+
+# Bytes which the WHATWG indexes map but Python's codecs don't.
+EXTRA_MAPPINGS = {
+    ('windows-1255', 0xca): '\u05ba',
+}
+
+def utf8_entry(charset, codec, byte):
+    try:
+        ch = bytes([byte]).decode(codec)
+    except UnicodeDecodeError:
+        ch = EXTRA_MAPPINGS.get((charset, byte))
+        if ch is None:
+            # The Windows code pages map unassigned bytes in 0x80-0x9f to the
+            # C1 control with the same value.  Anything else unassigned is an
+            # error.
+            if charset.startswith('windows-') and byte < 0xa0:
+                ch = chr(byte)
+            else:
+                ch = '\ufffd'
+    utf8 = ch.encode('utf-8')
+    assert len(ch) == 1 and len(utf8) <= 3
+    return [len(utf8)] + list(utf8) + [0] * (3 - len(utf8))
+
+def main(srcdir):
+    labels = {}
+    for i, (charset, codec, names) in enumerate(CHARSETS):
+        for label in names.split():
+            label = normalise(label)
+            assert labels.get(label, i) == i, label
+            labels[label] = i
+    keys = sorted(labels)
+    displacements, slots = generate([k.encode('ascii') for k in keys])
+    max_len = max(len(k) for k in keys)
+
+    h = [HEADER % {'name': 'charsettables.h'}]
+    h.append("""
+#ifndef OMEGA_INCLUDED_CHARSETTABLES_H
+#define OMEGA_INCLUDED_CHARSETTABLES_H
+
+#include <stddef.h>
+
+/** How to convert bytes 0x80 to 0xff of a single-byte character set.
+ *
+ *  Entry i is for byte 0x80 + i: the length of its UTF-8 form, then the
+ *  (up to three) bytes of it.  Bytes below 0x80 are ASCII.
+ */
+typedef unsigned char SingleByteTable[128][4];
+
+/** Look up the table for a single-byte character set.
+ *
+ *  Case, spaces, '-', '_' and '.' in the name are ignored.  Returns NULL if
+ *  there's no table for the character set.
+ */
+const SingleByteTable * single_byte_charset(const char *name, size_t len);
+
+#endif // OMEGA_INCLUDED_CHARSETTABLES_H
+""")
+
+    c = [HEADER % {'name': 'charsettables.cc'}]
+    c.append("""
+#include <config.h>
+
+#include "charsettables.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "perfecthash.h"
+
+#define CHARSET_LABELS %d
+#define CHARSET_BUCKETS %d
+#define CHARSET_SLOTS %d
+#define CHARSET_MAX_LABEL_LEN %d
+
+static const SingleByteTable charset_tables[] = {""" %
+             (len(keys), len(displacements), len(slots), max_len))
+    for charset, codec, names in CHARSETS:
+        entries = []
+        for byte in range(0x80, 0x100):
+            entries.extend(utf8_entry(charset, codec, byte))
+        c.append('    // %s' % charset)
+        c.append('    {')
+        for i in range(0, len(entries), 16):
+            row = entries[i:i + 16]
+            c.append('\t' + ', '.join('{%s}' % ', '.join(str(b) for b in row[j:j + 4])
+                                      for j in range(0, 16, 4)) + ',')
+        c.append('    },')
+    c.append("""};
+
+// The normalised labels, and the table each one uses.
+static const char * const charset_labels[CHARSET_LABELS] = {""")
+    for k in keys:
+        c.append('    "%s",' % k)
+    c.append("""};
+
+static const unsigned char charset_label_tables[CHARSET_LABELS] = {""")
+    c.append(format_array([labels[k] for k in keys]))
+    c.append("""};
+
+static const unsigned short charset_displacements[CHARSET_BUCKETS] = {""")
+    c.append(format_array(displacements))
+    c.append("""};
+
+// Index of the label stored in each slot, plus one (0 for an empty slot).
+static const unsigned char charset_slots[CHARSET_SLOTS] = {""")
+    c.append(format_array([s + 1 for s in slots]))
+    c.append("""};
+
+const SingleByteTable *
+single_byte_charset(const char *name, size_t len)
+{
+    char buf[CHARSET_MAX_LABEL_LEN];
+    size_t n = 0;
+    for (size_t i = 0; i != len; ++i) {
+	char ch = name[i];
+	if (ch == ' ' || ch == '-' || ch == '_' || ch == '.') continue;
+	if (n == sizeof(buf)) return NULL;
+	buf[n++] = tolower(static_cast<unsigned char>(ch));
+    }
+    unsigned d = charset_displacements[perfect_hash(0, buf, n) %% CHARSET_BUCKETS];
+    unsigned i = charset_slots[perfect_hash(d, buf, n) & (CHARSET_SLOTS - 1)];
+    if (i == 0) return NULL;
+    const char * label = charset_labels[i - 1];
+    if (strlen(label) != n || memcmp(label, buf, n) != 0) return NULL;
+    return &charset_tables[charset_label_tables[i - 1]];
+}
+""".replace('%%', '%'))
+
+    assert max(displacements) < 65536
+    assert len(keys) < 255
+
+    write_file(os.path.join(srcdir, 'charsettables.h'), h)
+    write_file(os.path.join(srcdir, 'charsettables.cc'), c)
+
+if __name__ == '__main__':
+    main(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src'))
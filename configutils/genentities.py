@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+"""Generate src/namedentities.h and src/namedentities.cc.
+
+These hold the HTML5 named character references, in a perfect hash table
+which can be searched directly from the bytes of the document.  The list
+of references comes from Python's html.entities module (so this script
+needs Python 3), and includes the legacy names which are recognised
+without a trailing semicolon.  Run from the top of the source tree:
+
+    python3 configutils/genentities.py
+
+"""
+
+import os
+import sys
+
+from perfecthash import generate, format_array
+from genhtmltags import write_file
+
+try:
+    from html.entities import html5
+except ImportError:
+    sys.stderr.write("genentities.py needs Python 3\n")
+    sys.exit(1)
+
+HEADER = """/* %(name)s: HTML5 named character references.
+ *
+ * This file is automatically generated by configutils/genentities.py
+ */
+"""
+
+def main(srcdir):
+    names = sorted(html5.keys())
+    keys = [n.encode('ascii') for n in names]
+    displacements, slots = generate(keys)
+
+    pool = []
+    offsets = []
+    size = 0
+    for key in keys:
+        offsets.append(size)
+        pool.append(key)
+        size += len(key)
+    assert size < 65536
+
+    codepoints = []
+    for n in names:
+        value = [ord(c) for c in html5[n]]
+        assert 1 <= len(value) <= 2
+        codepoints.extend(value + [0] * (2 - len(value)))
+
+    max_len = max(len(k) for k in keys)
+    legacy = [k for k in keys if not k.endswith(b';')]
+    max_legacy_len = max(len(k) for k in legacy)
+
+    h = [HEADER % {'name': 'namedentities.h'}]
+    h.append("""
+#ifndef OMEGA_INCLUDED_NAMEDENTITIES_H
+#define OMEGA_INCLUDED_NAMEDENTITIES_H
+
+#include <stddef.h>
+
+/// The length of the longest reference name, including any ';'.
+#define NAMED_ENTITY_MAX_LEN %d
+
+/// The length of the longest name recognised without a trailing ';'.
+#define NAMED_ENTITY_MAX_LEGACY_LEN %d
+
+/** Look up a named character reference.
+ *
+ *  @param p, len	The name, without the leading '&'.  Most names are
+ *			only recognised with their trailing ';' included, but
+ *			some legacy names are also recognised without.
+ *  @param cp		Set to the code points the reference stands for.
+ *
+ *  Returns the number of code points (1 or 2), or 0 if the name isn't
+ *  a named character reference.
+ */
+int named_entity_lookup(const char *p, size_t len, unsigned cp[2]);
+
+#endif // OMEGA_INCLUDED_NAMEDENTITIES_H
+""" % (max_len, max_legacy_len))
+
+    c = [HEADER % {'name': 'namedentities.cc'}]
+    c.append("""
+#include <config.h>
+
+#include "namedentities.h"
+
+#include <string.h>
+
+#include "perfecthash.h"
+
+#define ENTITY_COUNT %d
+#define ENTITY_BUCKETS %d
+#define ENTITY_SLOTS %d
+
+// All the names, end to end.
+static const char entity_names[] =""" % (len(keys), len(displacements), len(slots)))
+    line = '    "'
+    for key in pool:
+        piece = key.decode('ascii')
+        if len(line) + len(piece) > 76:
+            c.append(line + '"')
+            line = '    "'
+        line += piece
+    c.append(line + '";')
+
+    c.append("""
+// Offset of each name in entity_names; the extra entry gives the length of
+// the last name.
+static const unsigned short entity_offsets[ENTITY_COUNT + 1] = {""")
+    c.append(format_array(offsets + [size]))
+    c.append("""};
+
+// The one or two code points for each name (the second is 0 if unused).
+static const unsigned entity_codepoints[ENTITY_COUNT * 2] = {""")
+    c.append(format_array(codepoints, per_line=8))
+    c.append("""};
+
+static const unsigned short entity_displacements[ENTITY_BUCKETS] = {""")
+    c.append(format_array(displacements))
+    c.append("""};
+
+// Index of the name stored in each slot, plus one (0 for an empty slot).
+static const unsigned short entity_slots[ENTITY_SLOTS] = {""")
+    c.append(format_array([s + 1 for s in slots]))
+    c.append("""};
+
+int
+named_entity_lookup(const char *p, size_t len, unsigned cp[2])
+{
+    if (len > NAMED_ENTITY_MAX_LEN) return 0;
+    unsigned d = entity_displacements[perfect_hash(0, p, len) % ENTITY_BUCKETS];
+    unsigned i = entity_slots[perfect_hash(d, p, len) & (ENTITY_SLOTS - 1)];
+    if (i == 0) return 0;
+    --i;
+    size_t start = entity_offsets[i];
+    if (entity_offsets[i + 1] - start != len ||
+	memcmp(entity_names + start, p, len) != 0)
+	return 0;
+    cp[0] = entity_codepoints[i * 2];
+    cp[1] = entity_codepoints[i * 2 + 1];
+    return cp[1] ? 2 : 1;
+}
+""")
+
+    assert max(displacements) < 65536
+
+    write_file(os.path.join(srcdir, 'namedentities.h'), h)
+    write_file(os.path.join(srcdir, 'namedentities.cc'), c)
+
+if __name__ == '__main__':
+    main(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src'))
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+"""Generate src/htmltags.h and src/htmltags.cc.
+
+These map HTML element names to small integer ids using a perfect hash, so
+the parser can identify a tag with a couple of hash computations and one
+string comparison.  Run from the top of the source tree after changing the
+list of elements below (like the other generators, this needs Python 3):
+
+    python3 configutils/genhtmltags.py
+
+"""
+
+import os
+import sys
+
+from perfecthash import generate, format_array
+
+if sys.version_info[0] < 3:
+    sys.stderr.write("genhtmltags.py needs Python 3\n")
+    sys.exit(1)
+
+# Every element name in HTML 4, HTML 5, and the obsolete elements which
+# still turn up in the wild.
+ELEMENTS = """
+a abbr acronym address applet area article aside audio b base basefont bdi
+bdo bgsound big blink blockquote body br button canvas caption center cite
+code col colgroup data datalist dd del details dfn dialog dir div dl dt em
+embed fieldset figcaption figure font footer form frame frameset h1 h2 h3 h4
+h5 h6 head header hgroup hr html i iframe image img input ins isindex kbd
+keygen label legend li link listing main map mark marquee math menu menuitem
+meta meter multicol nav nextid nobr noembed noframes noscript object ol
+optgroup option output p param picture plaintext pre progress q rb rp rt rtc
+ruby s samp script search section select slot small source spacer span strike
+strong style sub summary sup svg table tbody td template textarea tfoot th
+thead time title tr track tt u ul var video wbr xmp
+""".split()
+
+HEADER = """/* %(name)s: ids for HTML element names.
+ *
+ * This file is automatically generated by configutils/genhtmltags.py
+ */
+"""
+
+def main(srcdir):
+    elements = sorted(set(ELEMENTS))
+    keys = [e.encode('ascii') for e in elements]
+    displacements, slots = generate(keys)
+
+    h = [HEADER % {'name': 'htmltags.h'}]
+    h.append("""
+#ifndef OMEGA_INCLUDED_HTMLTAGS_H
+#define OMEGA_INCLUDED_HTMLTAGS_H
+
+#include <stddef.h>
+
+enum HtmlTagId {
+    TAG_UNKNOWN = 0,""")
+    for e in elements:
+        h.append('    TAG_%s,' % e.upper())
+    h.append("""    TAG_COUNT
+};
+
+/** Look up the id of a lowercase element name.
+ *
+ *  Returns TAG_UNKNOWN for names which aren't HTML elements.
+ */
+HtmlTagId html_tag_lookup(const char *p, size_t len);
+
+/// Return the lowercase name for an id ("" for TAG_UNKNOWN).
+const char * html_tag_name(HtmlTagId id);
+
+/// Return the length of html_tag_name(id).
+size_t html_tag_name_len(HtmlTagId id);
+
+#endif // OMEGA_INCLUDED_HTMLTAGS_H
+""")
+
+    c = [HEADER % {'name': 'htmltags.cc'}]
+    c.append("""
+#include <config.h>
+
+#include "htmltags.h"
+
+#include <string.h>
+
+#include "perfecthash.h"
+
+static const char * const tag_names[TAG_COUNT] = {
+    "",""")
+    for e in elements:
+        c.append('    "%s",' % e)
+    c.append("""};
+
+static const unsigned char tag_name_lens[TAG_COUNT] = {
+    0,""")
+    c.append(format_array([len(e) for e in elements]))
+    c.append("""};
+
+#define TAG_BUCKETS %d
+#define TAG_SLOTS %d
+
+static const unsigned short tag_displacements[TAG_BUCKETS] = {""" %
+             (len(displacements), len(slots)))
+    c.append(format_array(displacements))
+    c.append("""};
+
+// The id of the tag stored in each slot, or TAG_UNKNOWN.
+static const unsigned char tag_slots[TAG_SLOTS] = {""")
+    c.append(format_array([s + 1 for s in slots]))
+    c.append("""};
+
+HtmlTagId
+html_tag_lookup(const char *p, size_t len)
+{
+    unsigned d = tag_displacements[perfect_hash(0, p, len) %% TAG_BUCKETS];
+    unsigned id = tag_slots[perfect_hash(d, p, len) & (TAG_SLOTS - 1)];
+    if (id == TAG_UNKNOWN || tag_name_lens[id] != len ||
+	memcmp(tag_names[id], p, len) != 0)
+	return TAG_UNKNOWN;
+    return HtmlTagId(id);
+}
+
+const char *
+html_tag_name(HtmlTagId id)
+{
+    return tag_names[id];
+}
+
+size_t
+html_tag_name_len(HtmlTagId id)
+{
+    return tag_name_lens[id];
+}
+""".replace('%%', '%'))
+
+    assert max(displacements) < 65536
+    assert len(elements) < 255
+
+    write_file(os.path.join(srcdir, 'htmltags.h'), h)
+    write_file(os.path.join(srcdir, 'htmltags.cc'), c)
+
+def write_file(path, parts):
+    text = '\n'.join(part.strip('\n') for part in parts) + '\n'
+    text = text.replace(' */\n', ' */\n\n', 1)
+    open(path, 'w').write(text)
+
+if __name__ == '__main__':
+    main(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src'))
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+"""Perfect hash table generation for the generated lookup tables.
+
+The tables use "hash and displace": each key is first hashed (with seed 0)
+into one of a number of buckets, and each bucket has a displacement seed
+chosen so that hashing every key in the bucket with that seed puts it in a
+distinct, otherwise unused slot.  A lookup therefore costs two hashes, one
+table load, and a single comparison against the only candidate key.
+
+The hash function must match perfect_hash() in src/perfecthash.h.
+
+"""
+
+def perfect_hash(seed, key):
+    """32 bit FNV-1a, with the offset basis perturbed by seed."""
+    h = (2166136261 ^ seed) & 0xffffffff
+    for c in bytearray(key):
+        h ^= c
+        h = (h * 16777619) & 0xffffffff
+    return h
+
+def generate(keys):
+    """Build a perfect hash for a list of distinct byte strings.
+
+    Returns (displacements, slots), where len(displacements) is the number
+    of buckets and len(slots) is a power of two.  slots[i] is the index in
+    keys of the key stored in slot i, or -1 for an empty slot.
+
+    """
+    size = 1
+    while size < len(keys) * 2:
+        size *= 2
+    nbuckets = max(1, len(keys) // 2)
+
+    buckets = [[] for i in range(nbuckets)]
+    for i, key in enumerate(keys):
+        buckets[perfect_hash(0, key) % nbuckets].append(i)
+
+    displacements = [0] * nbuckets
+    slots = [-1] * size
+    order = sorted(range(nbuckets), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            wanted = [perfect_hash(seed, keys[i]) & (size - 1)
+                      for i in buckets[b]]
+            if len(set(wanted)) == len(wanted) and \
+               all(slots[s] == -1 for s in wanted):
+                break
+            seed += 1
+        displacements[b] = seed
+        for i, s in zip(buckets[b], wanted):
+            slots[s] = i
+    return displacements, slots
+
+def format_array(values, per_line=12, indent='    '):
+    """Format a list of integers as the body of a C array initialiser."""
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
@@ -24,12 +24,25 @@ try:
 except ImportError:
   from configutils import Extension, setup, config, build_ext, using_setuptools
 
-# List of source files
+# List of source files.  src/charsettables.*, src/htmltags.* and
+# src/namedentities.* are generated, and checked in so that building doesn't
+# need the generators.  After changing a generator, rerun it with Python 3
+# from the top of the source tree, for example:
+#
+#     python3 configutils/genhtmltags.py
+#     python3 configutils/genentities.py
+#     python3 configutils/gencharsets.py
 htmltotext_sources = [
+    'src/charsettables.cc',
     'src/htmlparse.cc',
+    'src/htmltags.cc',
+    'src/mappedfile.cc',
     'src/metaxmlparse.cc',
     'src/myhtmlparse.cc',
+    'src/namedentities.cc',
     'src/pyhtmltotext.cc',
+    'src/sniffcharset.cc',
+    'src/utf8check.cc',
     'src/utf8convert.cc',
     'src/utf8itor.cc',
     'src/xmlparse.cc',
@@ -0,0 +1,268 @@
+/* charscan.h: vectorised scanning for HTML syntax characters.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_CHARSCAN_H
+#define OMEGA_INCLUDED_CHARSCAN_H
+
+// The scanners below look at 32 bytes at a time with AVX2, 16 bytes at a time
+// with SSE2 (always available on x86-64), and fall back to a plain loop
+// elsewhere and for the tail of the buffer.  Each one returns a pointer to the
+// first matching byte, or `end' if there isn't one.
+//
+// When compiled for AVX2 (with -mavx2 or similar) it's always used.
+// Otherwise, with GCC or clang on x86, the AVX2 code is compiled anyway and
+// used if the CPU supports it, so a default build runs anywhere but still
+// gets AVX2 where it's available.
+
+#if defined __AVX2__
+# define CHARSCAN_AVX2 1
+# define CHARSCAN_SSE2 1
+# include <immintrin.h>
+#elif defined __SSE2__ || defined _M_X64 || \
+      (defined _M_IX86_FP && _M_IX86_FP >= 2)
+# define CHARSCAN_SSE2 1
+# include <emmintrin.h>
+# if (defined __x86_64__ || defined __i386__) && \
+     (defined __clang__ || __GNUC__ > 4 || \
+      (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#  define CHARSCAN_AVX2 1
+#  define CHARSCAN_AVX2_DISPATCH 1
+#  include <immintrin.h>
+# endif
+#endif
+
+// Functions using AVX2 instructions, which need marking as such when the rest
+// of the code isn't compiled for AVX2.
+#ifdef CHARSCAN_AVX2_DISPATCH
+# define CHARSCAN_AVX2_TARGET __attribute__((target("avx2")))
+#else
+# define CHARSCAN_AVX2_TARGET
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+inline unsigned
+charscan_ctz(unsigned mask)
+{
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, mask);
+    return unsigned(i);
+#else
+    return unsigned(__builtin_ctz(mask));
+#endif
+}
+
+/// Match any one of up to three bytes (repeat a byte to match fewer).
+struct ScanBytes {
+    unsigned char a, b, c;
+
+    ScanBytes(char a_) : a(a_), b(a_), c(a_) { }
+    ScanBytes(char a_, char b_) : a(a_), b(b_), c(b_) { }
+    ScanBytes(char a_, char b_, char c_) : a(a_), b(b_), c(c_) { }
+
+    bool operator()(unsigned char ch) const {
+	return ch == a || ch == b || ch == c;
+    }
+#ifdef CHARSCAN_SSE2
+    __m128i operator()(__m128i v) const {
+	__m128i r = _mm_cmpeq_epi8(v, _mm_set1_epi8(char(a)));
+	r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(char(b))));
+	return _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(char(c))));
+    }
+#endif
+#ifdef CHARSCAN_AVX2
+    CHARSCAN_AVX2_TARGET __m256i operator()(__m256i v) const {
+	__m256i r = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(a)));
+	r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(b))));
+	return _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(c))));
+    }
+#endif
+};
+
+/** Match whitespace (as isspace() in the C locale) or either of two bytes.
+ *
+ *  Used for the ends of attribute names and unquoted attribute values.
+ */
+struct ScanSpaceOr {
+    unsigned char a, b;
+
+    ScanSpaceOr(char a_) : a(a_), b(a_) { }
+    ScanSpaceOr(char a_, char b_) : a(a_), b(b_) { }
+
+    bool operator()(unsigned char ch) const {
+	return ch == ' ' || unsigned(ch - '\t') <= unsigned('\r' - '\t') ||
+	       ch == a || ch == b;
+    }
+#ifdef CHARSCAN_SSE2
+    __m128i operator()(__m128i v) const {
+	// "\t" to "\r" are contiguous: v - '\t' saturates to zero after
+	// subtracting 4 more only for those five bytes.
+	__m128i t = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+	t = _mm_subs_epu8(t, _mm_set1_epi8('\r' - '\t'));
+	__m128i r = _mm_cmpeq_epi8(t, _mm_setzero_si128());
+	r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+	r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(char(a))));
+	return _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(char(b))));
+    }
+#endif
+#ifdef CHARSCAN_AVX2
+    CHARSCAN_AVX2_TARGET __m256i operator()(__m256i v) const {
+	__m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+	t = _mm256_subs_epu8(t, _mm256_set1_epi8('\r' - '\t'));
+	__m256i r = _mm256_cmpeq_epi8(t, _mm256_setzero_si256());
+	r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+	r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(a))));
+	return _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(b))));
+    }
+#endif
+};
+
+/** Match whitespace or a byte as ScanSpaceOr does, or a byte which can start
+ *  a UTF-8 encoded Unicode space separator other than ' ' (0xc2 for U+00A0,
+ *  and 0xe1 to 0xe3 for U+1680, U+2000 to U+200A, U+202F, U+205F and U+3000).
+ */
+struct ScanUnicodeSpaceOr {
+    ScanSpaceOr space;
+
+    ScanUnicodeSpaceOr(char a_) : space(a_) { }
+
+    bool operator()(unsigned char ch) const {
+	return space(ch) || ch == 0xc2 || unsigned(ch - 0xe1) <= 2;
+    }
+#ifdef CHARSCAN_SSE2
+    __m128i operator()(__m128i v) const {
+	__m128i r = space(v);
+	r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(char(0xc2))));
+	// As for "\t" to "\r" in ScanSpaceOr.
+	__m128i t = _mm_sub_epi8(v, _mm_set1_epi8(char(0xe1)));
+	t = _mm_subs_epu8(t, _mm_set1_epi8(2));
+	return _mm_or_si128(r, _mm_cmpeq_epi8(t, _mm_setzero_si128()));
+    }
+#endif
+#ifdef CHARSCAN_AVX2
+    CHARSCAN_AVX2_TARGET __m256i operator()(__m256i v) const {
+	__m256i r = space(v);
+	r = _mm256_or_si256(r, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(0xc2))));
+	__m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8(char(0xe1)));
+	t = _mm256_subs_epu8(t, _mm256_set1_epi8(2));
+	return _mm256_or_si256(r, _mm256_cmpeq_epi8(t, _mm256_setzero_si256()));
+    }
+#endif
+};
+
+/// Match any byte which isn't ASCII.
+struct ScanNonAscii {
+    bool operator()(unsigned char ch) const { return ch & 0x80; }
+#ifdef CHARSCAN_SSE2
+    // The movemask of the bytes themselves is their top bits.
+    __m128i operator()(__m128i v) const { return v; }
+#endif
+#ifdef CHARSCAN_AVX2
+    CHARSCAN_AVX2_TARGET __m256i operator()(__m256i v) const { return v; }
+#endif
+};
+
+#ifdef CHARSCAN_AVX2_DISPATCH
+/// Return true if the CPU supports AVX2.
+inline bool
+charscan_use_avx2()
+{
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+}
+
+/** Return the first byte in [p, end) matching pred, or where the last whole
+ *  block of 32 bytes ends if none of them match.
+ */
+template<class P>
+CHARSCAN_AVX2_TARGET const char *
+charscan_avx2(const char *p, const char *end, const P &pred)
+{
+    while (end - p >= 32) {
+	__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+	unsigned mask = unsigned(_mm256_movemask_epi8(pred(v)));
+	if (mask) return p + charscan_ctz(mask);
+	p += 32;
+    }
+    return p;
+}
+
+/** charscan() for the rest of a long span, using AVX2 if the CPU has it.
+ *
+ *  This is kept out of line, so charscan() stays small enough to inline.
+ */
+template<class P>
+__attribute__((noinline)) const char *
+charscan_long(const char *p, const char *end, const P &pred)
+{
+    if (charscan_use_avx2()) p = charscan_avx2(p, end, pred);
+    while (end - p >= 16) {
+	__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+	unsigned mask = unsigned(_mm_movemask_epi8(pred(v)));
+	if (mask) return p + charscan_ctz(mask);
+	p += 16;
+    }
+    while (p != end && !pred(static_cast<unsigned char>(*p))) ++p;
+    return p;
+}
+#endif
+
+/// Return the first byte in [p, end) matching pred, or end.
+template<class P>
+inline const char *
+charscan(const char *p, const char *end, const P &pred)
+{
+#if defined CHARSCAN_AVX2 && !defined CHARSCAN_AVX2_DISPATCH
+    while (end - p >= 32) {
+	__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+	unsigned mask = unsigned(_mm256_movemask_epi8(pred(v)));
+	if (mask) return p + charscan_ctz(mask);
+	p += 32;
+    }
+#endif
+#ifdef CHARSCAN_SSE2
+# ifdef CHARSCAN_AVX2_DISPATCH
+    // Matches are usually close, so only look further than this here.
+    const char * near_end = (end - p > 64) ? p + 64 : end;
+# else
+    const char * near_end = end;
+# endif
+    while (near_end - p >= 16) {
+	__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+	unsigned mask = unsigned(_mm_movemask_epi8(pred(v)));
+	if (mask) return p + charscan_ctz(mask);
+	p += 16;
+    }
+# ifdef CHARSCAN_AVX2_DISPATCH
+    if (end - p >= 64) return charscan_long(p, end, pred);
+    while (end - p >= 16) {
+	__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+	unsigned mask = unsigned(_mm_movemask_epi8(pred(v)));
+	if (mask) return p + charscan_ctz(mask);
+	p += 16;
+    }
+# endif
+#endif
+    while (p != end && !pred(static_cast<unsigned char>(*p))) ++p;
+    return p;
+}
+
+#endif // OMEGA_INCLUDED_CHARSCAN_H
@@ -0,0 +1,1053 @@
+/* charsettables.cc: tables for converting single-byte character sets.
+ *
+ * This file is automatically generated by configutils/gencharsets.py
+ */
+
+#include <config.h>
+
+#include "charsettables.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "perfecthash.h"
+
+#define CHARSET_LABELS 121
+#define CHARSET_BUCKETS 60
+#define CHARSET_SLOTS 256
+#define CHARSET_MAX_LABEL_LEN 18
+
+static const SingleByteTable charset_tables[] = {
+    // windows-874
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {3, 226, 128, 166}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 224, 184, 129}, {3, 224, 184, 130}, {3, 224, 184, 131},
+	{3, 224, 184, 132}, {3, 224, 184, 133}, {3, 224, 184, 134}, {3, 224, 184, 135},
+	{3, 224, 184, 136}, {3, 224, 184, 137}, {3, 224, 184, 138}, {3, 224, 184, 139},
+	{3, 224, 184, 140}, {3, 224, 184, 141}, {3, 224, 184, 142}, {3, 224, 184, 143},
+	{3, 224, 184, 144}, {3, 224, 184, 145}, {3, 224, 184, 146}, {3, 224, 184, 147},
+	{3, 224, 184, 148}, {3, 224, 184, 149}, {3, 224, 184, 150}, {3, 224, 184, 151},
+	{3, 224, 184, 152}, {3, 224, 184, 153}, {3, 224, 184, 154}, {3, 224, 184, 155},
+	{3, 224, 184, 156}, {3, 224, 184, 157}, {3, 224, 184, 158}, {3, 224, 184, 159},
+	{3, 224, 184, 160}, {3, 224, 184, 161}, {3, 224, 184, 162}, {3, 224, 184, 163},
+	{3, 224, 184, 164}, {3, 224, 184, 165}, {3, 224, 184, 166}, {3, 224, 184, 167},
+	{3, 224, 184, 168}, {3, 224, 184, 169}, {3, 224, 184, 170}, {3, 224, 184, 171},
+	{3, 224, 184, 172}, {3, 224, 184, 173}, {3, 224, 184, 174}, {3, 224, 184, 175},
+	{3, 224, 184, 176}, {3, 224, 184, 177}, {3, 224, 184, 178}, {3, 224, 184, 179},
+	{3, 224, 184, 180}, {3, 224, 184, 181}, {3, 224, 184, 182}, {3, 224, 184, 183},
+	{3, 224, 184, 184}, {3, 224, 184, 185}, {3, 224, 184, 186}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 224, 184, 191},
+	{3, 224, 185, 128}, {3, 224, 185, 129}, {3, 224, 185, 130}, {3, 224, 185, 131},
+	{3, 224, 185, 132}, {3, 224, 185, 133}, {3, 224, 185, 134}, {3, 224, 185, 135},
+	{3, 224, 185, 136}, {3, 224, 185, 137}, {3, 224, 185, 138}, {3, 224, 185, 139},
+	{3, 224, 185, 140}, {3, 224, 185, 141}, {3, 224, 185, 142}, {3, 224, 185, 143},
+	{3, 224, 185, 144}, {3, 224, 185, 145}, {3, 224, 185, 146}, {3, 224, 185, 147},
+	{3, 224, 185, 148}, {3, 224, 185, 149}, {3, 224, 185, 150}, {3, 224, 185, 151},
+	{3, 224, 185, 152}, {3, 224, 185, 153}, {3, 224, 185, 154}, {3, 224, 185, 155},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+    },
+    // windows-1250
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 194, 131, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 194, 136, 0}, {3, 226, 128, 176}, {2, 197, 160, 0}, {3, 226, 128, 185},
+	{2, 197, 154, 0}, {2, 197, 164, 0}, {2, 197, 189, 0}, {2, 197, 185, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 194, 152, 0}, {3, 226, 132, 162}, {2, 197, 161, 0}, {3, 226, 128, 186},
+	{2, 197, 155, 0}, {2, 197, 165, 0}, {2, 197, 190, 0}, {2, 197, 186, 0},
+	{2, 194, 160, 0}, {2, 203, 135, 0}, {2, 203, 152, 0}, {2, 197, 129, 0},
+	{2, 194, 164, 0}, {2, 196, 132, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 197, 158, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 197, 187, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 203, 155, 0}, {2, 197, 130, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 196, 133, 0}, {2, 197, 159, 0}, {2, 194, 187, 0},
+	{2, 196, 189, 0}, {2, 203, 157, 0}, {2, 196, 190, 0}, {2, 197, 188, 0},
+	{2, 197, 148, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 196, 130, 0},
+	{2, 195, 132, 0}, {2, 196, 185, 0}, {2, 196, 134, 0}, {2, 195, 135, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 196, 152, 0}, {2, 195, 139, 0},
+	{2, 196, 154, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 196, 142, 0},
+	{2, 196, 144, 0}, {2, 197, 131, 0}, {2, 197, 135, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 197, 144, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 197, 152, 0}, {2, 197, 174, 0}, {2, 195, 154, 0}, {2, 197, 176, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 197, 162, 0}, {2, 195, 159, 0},
+	{2, 197, 149, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 196, 131, 0},
+	{2, 195, 164, 0}, {2, 196, 186, 0}, {2, 196, 135, 0}, {2, 195, 167, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 196, 153, 0}, {2, 195, 171, 0},
+	{2, 196, 155, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 196, 143, 0},
+	{2, 196, 145, 0}, {2, 197, 132, 0}, {2, 197, 136, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 197, 145, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 197, 153, 0}, {2, 197, 175, 0}, {2, 195, 186, 0}, {2, 197, 177, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 197, 163, 0}, {2, 203, 153, 0},
+    },
+    // windows-1251
+    {
+	{2, 208, 130, 0}, {2, 208, 131, 0}, {3, 226, 128, 154}, {2, 209, 147, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{3, 226, 130, 172}, {3, 226, 128, 176}, {2, 208, 137, 0}, {3, 226, 128, 185},
+	{2, 208, 138, 0}, {2, 208, 140, 0}, {2, 208, 139, 0}, {2, 208, 143, 0},
+	{2, 209, 146, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 194, 152, 0}, {3, 226, 132, 162}, {2, 209, 153, 0}, {3, 226, 128, 186},
+	{2, 209, 154, 0}, {2, 209, 156, 0}, {2, 209, 155, 0}, {2, 209, 159, 0},
+	{2, 194, 160, 0}, {2, 208, 142, 0}, {2, 209, 158, 0}, {2, 208, 136, 0},
+	{2, 194, 164, 0}, {2, 210, 144, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 208, 129, 0}, {2, 194, 169, 0}, {2, 208, 132, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 208, 135, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 208, 134, 0}, {2, 209, 150, 0},
+	{2, 210, 145, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 209, 145, 0}, {3, 226, 132, 150}, {2, 209, 148, 0}, {2, 194, 187, 0},
+	{2, 209, 152, 0}, {2, 208, 133, 0}, {2, 209, 149, 0}, {2, 209, 151, 0},
+	{2, 208, 144, 0}, {2, 208, 145, 0}, {2, 208, 146, 0}, {2, 208, 147, 0},
+	{2, 208, 148, 0}, {2, 208, 149, 0}, {2, 208, 150, 0}, {2, 208, 151, 0},
+	{2, 208, 152, 0}, {2, 208, 153, 0}, {2, 208, 154, 0}, {2, 208, 155, 0},
+	{2, 208, 156, 0}, {2, 208, 157, 0}, {2, 208, 158, 0}, {2, 208, 159, 0},
+	{2, 208, 160, 0}, {2, 208, 161, 0}, {2, 208, 162, 0}, {2, 208, 163, 0},
+	{2, 208, 164, 0}, {2, 208, 165, 0}, {2, 208, 166, 0}, {2, 208, 167, 0},
+	{2, 208, 168, 0}, {2, 208, 169, 0}, {2, 208, 170, 0}, {2, 208, 171, 0},
+	{2, 208, 172, 0}, {2, 208, 173, 0}, {2, 208, 174, 0}, {2, 208, 175, 0},
+	{2, 208, 176, 0}, {2, 208, 177, 0}, {2, 208, 178, 0}, {2, 208, 179, 0},
+	{2, 208, 180, 0}, {2, 208, 181, 0}, {2, 208, 182, 0}, {2, 208, 183, 0},
+	{2, 208, 184, 0}, {2, 208, 185, 0}, {2, 208, 186, 0}, {2, 208, 187, 0},
+	{2, 208, 188, 0}, {2, 208, 189, 0}, {2, 208, 190, 0}, {2, 208, 191, 0},
+	{2, 209, 128, 0}, {2, 209, 129, 0}, {2, 209, 130, 0}, {2, 209, 131, 0},
+	{2, 209, 132, 0}, {2, 209, 133, 0}, {2, 209, 134, 0}, {2, 209, 135, 0},
+	{2, 209, 136, 0}, {2, 209, 137, 0}, {2, 209, 138, 0}, {2, 209, 139, 0},
+	{2, 209, 140, 0}, {2, 209, 141, 0}, {2, 209, 142, 0}, {2, 209, 143, 0},
+    },
+    // windows-1252
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 203, 134, 0}, {3, 226, 128, 176}, {2, 197, 160, 0}, {3, 226, 128, 185},
+	{2, 197, 146, 0}, {2, 194, 141, 0}, {2, 197, 189, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 203, 156, 0}, {3, 226, 132, 162}, {2, 197, 161, 0}, {3, 226, 128, 186},
+	{2, 197, 147, 0}, {2, 194, 157, 0}, {2, 197, 190, 0}, {2, 197, 184, 0},
+	{2, 194, 160, 0}, {2, 194, 161, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 194, 170, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 194, 186, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 194, 191, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 195, 144, 0}, {2, 195, 145, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 195, 152, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 195, 158, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 195, 176, 0}, {2, 195, 177, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 195, 184, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 195, 190, 0}, {2, 195, 191, 0},
+    },
+    // windows-1253
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 194, 136, 0}, {3, 226, 128, 176}, {2, 194, 138, 0}, {3, 226, 128, 185},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 194, 152, 0}, {3, 226, 132, 162}, {2, 194, 154, 0}, {3, 226, 128, 186},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 206, 133, 0}, {2, 206, 134, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {3, 239, 191, 189}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {3, 226, 128, 149},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 206, 132, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 206, 136, 0}, {2, 206, 137, 0}, {2, 206, 138, 0}, {2, 194, 187, 0},
+	{2, 206, 140, 0}, {2, 194, 189, 0}, {2, 206, 142, 0}, {2, 206, 143, 0},
+	{2, 206, 144, 0}, {2, 206, 145, 0}, {2, 206, 146, 0}, {2, 206, 147, 0},
+	{2, 206, 148, 0}, {2, 206, 149, 0}, {2, 206, 150, 0}, {2, 206, 151, 0},
+	{2, 206, 152, 0}, {2, 206, 153, 0}, {2, 206, 154, 0}, {2, 206, 155, 0},
+	{2, 206, 156, 0}, {2, 206, 157, 0}, {2, 206, 158, 0}, {2, 206, 159, 0},
+	{2, 206, 160, 0}, {2, 206, 161, 0}, {3, 239, 191, 189}, {2, 206, 163, 0},
+	{2, 206, 164, 0}, {2, 206, 165, 0}, {2, 206, 166, 0}, {2, 206, 167, 0},
+	{2, 206, 168, 0}, {2, 206, 169, 0}, {2, 206, 170, 0}, {2, 206, 171, 0},
+	{2, 206, 172, 0}, {2, 206, 173, 0}, {2, 206, 174, 0}, {2, 206, 175, 0},
+	{2, 206, 176, 0}, {2, 206, 177, 0}, {2, 206, 178, 0}, {2, 206, 179, 0},
+	{2, 206, 180, 0}, {2, 206, 181, 0}, {2, 206, 182, 0}, {2, 206, 183, 0},
+	{2, 206, 184, 0}, {2, 206, 185, 0}, {2, 206, 186, 0}, {2, 206, 187, 0},
+	{2, 206, 188, 0}, {2, 206, 189, 0}, {2, 206, 190, 0}, {2, 206, 191, 0},
+	{2, 207, 128, 0}, {2, 207, 129, 0}, {2, 207, 130, 0}, {2, 207, 131, 0},
+	{2, 207, 132, 0}, {2, 207, 133, 0}, {2, 207, 134, 0}, {2, 207, 135, 0},
+	{2, 207, 136, 0}, {2, 207, 137, 0}, {2, 207, 138, 0}, {2, 207, 139, 0},
+	{2, 207, 140, 0}, {2, 207, 141, 0}, {2, 207, 142, 0}, {3, 239, 191, 189},
+    },
+    // windows-1254
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 203, 134, 0}, {3, 226, 128, 176}, {2, 197, 160, 0}, {3, 226, 128, 185},
+	{2, 197, 146, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 203, 156, 0}, {3, 226, 132, 162}, {2, 197, 161, 0}, {3, 226, 128, 186},
+	{2, 197, 147, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 197, 184, 0},
+	{2, 194, 160, 0}, {2, 194, 161, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 194, 170, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 194, 186, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 194, 191, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 196, 158, 0}, {2, 195, 145, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 195, 152, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 196, 176, 0}, {2, 197, 158, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 196, 159, 0}, {2, 195, 177, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 195, 184, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 196, 177, 0}, {2, 197, 159, 0}, {2, 195, 191, 0},
+    },
+    // windows-1255
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 203, 134, 0}, {3, 226, 128, 176}, {2, 194, 138, 0}, {3, 226, 128, 185},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 203, 156, 0}, {3, 226, 132, 162}, {2, 194, 154, 0}, {3, 226, 128, 186},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 194, 161, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{3, 226, 130, 170}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 195, 151, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 195, 183, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 194, 191, 0},
+	{2, 214, 176, 0}, {2, 214, 177, 0}, {2, 214, 178, 0}, {2, 214, 179, 0},
+	{2, 214, 180, 0}, {2, 214, 181, 0}, {2, 214, 182, 0}, {2, 214, 183, 0},
+	{2, 214, 184, 0}, {2, 214, 185, 0}, {2, 214, 186, 0}, {2, 214, 187, 0},
+	{2, 214, 188, 0}, {2, 214, 189, 0}, {2, 214, 190, 0}, {2, 214, 191, 0},
+	{2, 215, 128, 0}, {2, 215, 129, 0}, {2, 215, 130, 0}, {2, 215, 131, 0},
+	{2, 215, 176, 0}, {2, 215, 177, 0}, {2, 215, 178, 0}, {2, 215, 179, 0},
+	{2, 215, 180, 0}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{2, 215, 144, 0}, {2, 215, 145, 0}, {2, 215, 146, 0}, {2, 215, 147, 0},
+	{2, 215, 148, 0}, {2, 215, 149, 0}, {2, 215, 150, 0}, {2, 215, 151, 0},
+	{2, 215, 152, 0}, {2, 215, 153, 0}, {2, 215, 154, 0}, {2, 215, 155, 0},
+	{2, 215, 156, 0}, {2, 215, 157, 0}, {2, 215, 158, 0}, {2, 215, 159, 0},
+	{2, 215, 160, 0}, {2, 215, 161, 0}, {2, 215, 162, 0}, {2, 215, 163, 0},
+	{2, 215, 164, 0}, {2, 215, 165, 0}, {2, 215, 166, 0}, {2, 215, 167, 0},
+	{2, 215, 168, 0}, {2, 215, 169, 0}, {2, 215, 170, 0}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 226, 128, 142}, {3, 226, 128, 143}, {3, 239, 191, 189},
+    },
+    // windows-1256
+    {
+	{3, 226, 130, 172}, {2, 217, 190, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 203, 134, 0}, {3, 226, 128, 176}, {2, 217, 185, 0}, {3, 226, 128, 185},
+	{2, 197, 146, 0}, {2, 218, 134, 0}, {2, 218, 152, 0}, {2, 218, 136, 0},
+	{2, 218, 175, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 218, 169, 0}, {3, 226, 132, 162}, {2, 218, 145, 0}, {3, 226, 128, 186},
+	{2, 197, 147, 0}, {3, 226, 128, 140}, {3, 226, 128, 141}, {2, 218, 186, 0},
+	{2, 194, 160, 0}, {2, 216, 140, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 218, 190, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 216, 155, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 216, 159, 0},
+	{2, 219, 129, 0}, {2, 216, 161, 0}, {2, 216, 162, 0}, {2, 216, 163, 0},
+	{2, 216, 164, 0}, {2, 216, 165, 0}, {2, 216, 166, 0}, {2, 216, 167, 0},
+	{2, 216, 168, 0}, {2, 216, 169, 0}, {2, 216, 170, 0}, {2, 216, 171, 0},
+	{2, 216, 172, 0}, {2, 216, 173, 0}, {2, 216, 174, 0}, {2, 216, 175, 0},
+	{2, 216, 176, 0}, {2, 216, 177, 0}, {2, 216, 178, 0}, {2, 216, 179, 0},
+	{2, 216, 180, 0}, {2, 216, 181, 0}, {2, 216, 182, 0}, {2, 195, 151, 0},
+	{2, 216, 183, 0}, {2, 216, 184, 0}, {2, 216, 185, 0}, {2, 216, 186, 0},
+	{2, 217, 128, 0}, {2, 217, 129, 0}, {2, 217, 130, 0}, {2, 217, 131, 0},
+	{2, 195, 160, 0}, {2, 217, 132, 0}, {2, 195, 162, 0}, {2, 217, 133, 0},
+	{2, 217, 134, 0}, {2, 217, 135, 0}, {2, 217, 136, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 217, 137, 0}, {2, 217, 138, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 217, 139, 0}, {2, 217, 140, 0}, {2, 217, 141, 0}, {2, 217, 142, 0},
+	{2, 195, 180, 0}, {2, 217, 143, 0}, {2, 217, 144, 0}, {2, 195, 183, 0},
+	{2, 217, 145, 0}, {2, 195, 185, 0}, {2, 217, 146, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {3, 226, 128, 142}, {3, 226, 128, 143}, {2, 219, 146, 0},
+    },
+    // windows-1257
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 194, 131, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 194, 136, 0}, {3, 226, 128, 176}, {2, 194, 138, 0}, {3, 226, 128, 185},
+	{2, 194, 140, 0}, {2, 194, 168, 0}, {2, 203, 135, 0}, {2, 194, 184, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 194, 152, 0}, {3, 226, 132, 162}, {2, 194, 154, 0}, {3, 226, 128, 186},
+	{2, 194, 156, 0}, {2, 194, 175, 0}, {2, 203, 155, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 239, 191, 189}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {3, 239, 191, 189}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 195, 152, 0}, {2, 194, 169, 0}, {2, 197, 150, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 195, 134, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 195, 184, 0}, {2, 194, 185, 0}, {2, 197, 151, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 195, 166, 0},
+	{2, 196, 132, 0}, {2, 196, 174, 0}, {2, 196, 128, 0}, {2, 196, 134, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 196, 152, 0}, {2, 196, 146, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 197, 185, 0}, {2, 196, 150, 0},
+	{2, 196, 162, 0}, {2, 196, 182, 0}, {2, 196, 170, 0}, {2, 196, 187, 0},
+	{2, 197, 160, 0}, {2, 197, 131, 0}, {2, 197, 133, 0}, {2, 195, 147, 0},
+	{2, 197, 140, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 197, 178, 0}, {2, 197, 129, 0}, {2, 197, 154, 0}, {2, 197, 170, 0},
+	{2, 195, 156, 0}, {2, 197, 187, 0}, {2, 197, 189, 0}, {2, 195, 159, 0},
+	{2, 196, 133, 0}, {2, 196, 175, 0}, {2, 196, 129, 0}, {2, 196, 135, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 196, 153, 0}, {2, 196, 147, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 197, 186, 0}, {2, 196, 151, 0},
+	{2, 196, 163, 0}, {2, 196, 183, 0}, {2, 196, 171, 0}, {2, 196, 188, 0},
+	{2, 197, 161, 0}, {2, 197, 132, 0}, {2, 197, 134, 0}, {2, 195, 179, 0},
+	{2, 197, 141, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 197, 179, 0}, {2, 197, 130, 0}, {2, 197, 155, 0}, {2, 197, 171, 0},
+	{2, 195, 188, 0}, {2, 197, 188, 0}, {2, 197, 190, 0}, {2, 203, 153, 0},
+    },
+    // windows-1258
+    {
+	{3, 226, 130, 172}, {2, 194, 129, 0}, {3, 226, 128, 154}, {2, 198, 146, 0},
+	{3, 226, 128, 158}, {3, 226, 128, 166}, {3, 226, 128, 160}, {3, 226, 128, 161},
+	{2, 203, 134, 0}, {3, 226, 128, 176}, {2, 194, 138, 0}, {3, 226, 128, 185},
+	{2, 197, 146, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {3, 226, 128, 156},
+	{3, 226, 128, 157}, {3, 226, 128, 162}, {3, 226, 128, 147}, {3, 226, 128, 148},
+	{2, 203, 156, 0}, {3, 226, 132, 162}, {2, 194, 154, 0}, {3, 226, 128, 186},
+	{2, 197, 147, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 197, 184, 0},
+	{2, 194, 160, 0}, {2, 194, 161, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 194, 170, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 194, 186, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 194, 191, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 196, 130, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 204, 128, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 196, 144, 0}, {2, 195, 145, 0}, {2, 204, 137, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 198, 160, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 195, 152, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 198, 175, 0}, {2, 204, 131, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 196, 131, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 204, 129, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 196, 145, 0}, {2, 195, 177, 0}, {2, 204, 163, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 198, 161, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 195, 184, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 198, 176, 0}, {3, 226, 130, 171}, {2, 195, 191, 0},
+    },
+    // iso-8859-2
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 196, 132, 0}, {2, 203, 152, 0}, {2, 197, 129, 0},
+	{2, 194, 164, 0}, {2, 196, 189, 0}, {2, 197, 154, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 197, 160, 0}, {2, 197, 158, 0}, {2, 197, 164, 0},
+	{2, 197, 185, 0}, {2, 194, 173, 0}, {2, 197, 189, 0}, {2, 197, 187, 0},
+	{2, 194, 176, 0}, {2, 196, 133, 0}, {2, 203, 155, 0}, {2, 197, 130, 0},
+	{2, 194, 180, 0}, {2, 196, 190, 0}, {2, 197, 155, 0}, {2, 203, 135, 0},
+	{2, 194, 184, 0}, {2, 197, 161, 0}, {2, 197, 159, 0}, {2, 197, 165, 0},
+	{2, 197, 186, 0}, {2, 203, 157, 0}, {2, 197, 190, 0}, {2, 197, 188, 0},
+	{2, 197, 148, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 196, 130, 0},
+	{2, 195, 132, 0}, {2, 196, 185, 0}, {2, 196, 134, 0}, {2, 195, 135, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 196, 152, 0}, {2, 195, 139, 0},
+	{2, 196, 154, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 196, 142, 0},
+	{2, 196, 144, 0}, {2, 197, 131, 0}, {2, 197, 135, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 197, 144, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 197, 152, 0}, {2, 197, 174, 0}, {2, 195, 154, 0}, {2, 197, 176, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 197, 162, 0}, {2, 195, 159, 0},
+	{2, 197, 149, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 196, 131, 0},
+	{2, 195, 164, 0}, {2, 196, 186, 0}, {2, 196, 135, 0}, {2, 195, 167, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 196, 153, 0}, {2, 195, 171, 0},
+	{2, 196, 155, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 196, 143, 0},
+	{2, 196, 145, 0}, {2, 197, 132, 0}, {2, 197, 136, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 197, 145, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 197, 153, 0}, {2, 197, 175, 0}, {2, 195, 186, 0}, {2, 197, 177, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 197, 163, 0}, {2, 203, 153, 0},
+    },
+    // iso-8859-3
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 196, 166, 0}, {2, 203, 152, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {3, 239, 191, 189}, {2, 196, 164, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 196, 176, 0}, {2, 197, 158, 0}, {2, 196, 158, 0},
+	{2, 196, 180, 0}, {2, 194, 173, 0}, {3, 239, 191, 189}, {2, 197, 187, 0},
+	{2, 194, 176, 0}, {2, 196, 167, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 196, 165, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 196, 177, 0}, {2, 197, 159, 0}, {2, 196, 159, 0},
+	{2, 196, 181, 0}, {2, 194, 189, 0}, {3, 239, 191, 189}, {2, 197, 188, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {3, 239, 191, 189},
+	{2, 195, 132, 0}, {2, 196, 138, 0}, {2, 196, 136, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{3, 239, 191, 189}, {2, 195, 145, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 196, 160, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 196, 156, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 197, 172, 0}, {2, 197, 156, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {3, 239, 191, 189},
+	{2, 195, 164, 0}, {2, 196, 139, 0}, {2, 196, 137, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{3, 239, 191, 189}, {2, 195, 177, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 196, 161, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 196, 157, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 197, 173, 0}, {2, 197, 157, 0}, {2, 203, 153, 0},
+    },
+    // iso-8859-4
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 196, 132, 0}, {2, 196, 184, 0}, {2, 197, 150, 0},
+	{2, 194, 164, 0}, {2, 196, 168, 0}, {2, 196, 187, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 197, 160, 0}, {2, 196, 146, 0}, {2, 196, 162, 0},
+	{2, 197, 166, 0}, {2, 194, 173, 0}, {2, 197, 189, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 196, 133, 0}, {2, 203, 155, 0}, {2, 197, 151, 0},
+	{2, 194, 180, 0}, {2, 196, 169, 0}, {2, 196, 188, 0}, {2, 203, 135, 0},
+	{2, 194, 184, 0}, {2, 197, 161, 0}, {2, 196, 147, 0}, {2, 196, 163, 0},
+	{2, 197, 167, 0}, {2, 197, 138, 0}, {2, 197, 190, 0}, {2, 197, 139, 0},
+	{2, 196, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 196, 174, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 196, 152, 0}, {2, 195, 139, 0},
+	{2, 196, 150, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 196, 170, 0},
+	{2, 196, 144, 0}, {2, 197, 133, 0}, {2, 197, 140, 0}, {2, 196, 182, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 195, 152, 0}, {2, 197, 178, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 197, 168, 0}, {2, 197, 170, 0}, {2, 195, 159, 0},
+	{2, 196, 129, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 196, 175, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 196, 153, 0}, {2, 195, 171, 0},
+	{2, 196, 151, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 196, 171, 0},
+	{2, 196, 145, 0}, {2, 197, 134, 0}, {2, 197, 141, 0}, {2, 196, 183, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 195, 184, 0}, {2, 197, 179, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 197, 169, 0}, {2, 197, 171, 0}, {2, 203, 153, 0},
+    },
+    // iso-8859-5
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 208, 129, 0}, {2, 208, 130, 0}, {2, 208, 131, 0},
+	{2, 208, 132, 0}, {2, 208, 133, 0}, {2, 208, 134, 0}, {2, 208, 135, 0},
+	{2, 208, 136, 0}, {2, 208, 137, 0}, {2, 208, 138, 0}, {2, 208, 139, 0},
+	{2, 208, 140, 0}, {2, 194, 173, 0}, {2, 208, 142, 0}, {2, 208, 143, 0},
+	{2, 208, 144, 0}, {2, 208, 145, 0}, {2, 208, 146, 0}, {2, 208, 147, 0},
+	{2, 208, 148, 0}, {2, 208, 149, 0}, {2, 208, 150, 0}, {2, 208, 151, 0},
+	{2, 208, 152, 0}, {2, 208, 153, 0}, {2, 208, 154, 0}, {2, 208, 155, 0},
+	{2, 208, 156, 0}, {2, 208, 157, 0}, {2, 208, 158, 0}, {2, 208, 159, 0},
+	{2, 208, 160, 0}, {2, 208, 161, 0}, {2, 208, 162, 0}, {2, 208, 163, 0},
+	{2, 208, 164, 0}, {2, 208, 165, 0}, {2, 208, 166, 0}, {2, 208, 167, 0},
+	{2, 208, 168, 0}, {2, 208, 169, 0}, {2, 208, 170, 0}, {2, 208, 171, 0},
+	{2, 208, 172, 0}, {2, 208, 173, 0}, {2, 208, 174, 0}, {2, 208, 175, 0},
+	{2, 208, 176, 0}, {2, 208, 177, 0}, {2, 208, 178, 0}, {2, 208, 179, 0},
+	{2, 208, 180, 0}, {2, 208, 181, 0}, {2, 208, 182, 0}, {2, 208, 183, 0},
+	{2, 208, 184, 0}, {2, 208, 185, 0}, {2, 208, 186, 0}, {2, 208, 187, 0},
+	{2, 208, 188, 0}, {2, 208, 189, 0}, {2, 208, 190, 0}, {2, 208, 191, 0},
+	{2, 209, 128, 0}, {2, 209, 129, 0}, {2, 209, 130, 0}, {2, 209, 131, 0},
+	{2, 209, 132, 0}, {2, 209, 133, 0}, {2, 209, 134, 0}, {2, 209, 135, 0},
+	{2, 209, 136, 0}, {2, 209, 137, 0}, {2, 209, 138, 0}, {2, 209, 139, 0},
+	{2, 209, 140, 0}, {2, 209, 141, 0}, {2, 209, 142, 0}, {2, 209, 143, 0},
+	{3, 226, 132, 150}, {2, 209, 145, 0}, {2, 209, 146, 0}, {2, 209, 147, 0},
+	{2, 209, 148, 0}, {2, 209, 149, 0}, {2, 209, 150, 0}, {2, 209, 151, 0},
+	{2, 209, 152, 0}, {2, 209, 153, 0}, {2, 209, 154, 0}, {2, 209, 155, 0},
+	{2, 209, 156, 0}, {2, 194, 167, 0}, {2, 209, 158, 0}, {2, 209, 159, 0},
+    },
+    // iso-8859-6
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{2, 194, 164, 0}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{2, 216, 140, 0}, {2, 194, 173, 0}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {2, 216, 155, 0},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {2, 216, 159, 0},
+	{3, 239, 191, 189}, {2, 216, 161, 0}, {2, 216, 162, 0}, {2, 216, 163, 0},
+	{2, 216, 164, 0}, {2, 216, 165, 0}, {2, 216, 166, 0}, {2, 216, 167, 0},
+	{2, 216, 168, 0}, {2, 216, 169, 0}, {2, 216, 170, 0}, {2, 216, 171, 0},
+	{2, 216, 172, 0}, {2, 216, 173, 0}, {2, 216, 174, 0}, {2, 216, 175, 0},
+	{2, 216, 176, 0}, {2, 216, 177, 0}, {2, 216, 178, 0}, {2, 216, 179, 0},
+	{2, 216, 180, 0}, {2, 216, 181, 0}, {2, 216, 182, 0}, {2, 216, 183, 0},
+	{2, 216, 184, 0}, {2, 216, 185, 0}, {2, 216, 186, 0}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{2, 217, 128, 0}, {2, 217, 129, 0}, {2, 217, 130, 0}, {2, 217, 131, 0},
+	{2, 217, 132, 0}, {2, 217, 133, 0}, {2, 217, 134, 0}, {2, 217, 135, 0},
+	{2, 217, 136, 0}, {2, 217, 137, 0}, {2, 217, 138, 0}, {2, 217, 139, 0},
+	{2, 217, 140, 0}, {2, 217, 141, 0}, {2, 217, 142, 0}, {2, 217, 143, 0},
+	{2, 217, 144, 0}, {2, 217, 145, 0}, {2, 217, 146, 0}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+    },
+    // iso-8859-7
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 226, 128, 152}, {3, 226, 128, 153}, {2, 194, 163, 0},
+	{3, 226, 130, 172}, {3, 226, 130, 175}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 205, 186, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {3, 239, 191, 189}, {3, 226, 128, 149},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 206, 132, 0}, {2, 206, 133, 0}, {2, 206, 134, 0}, {2, 194, 183, 0},
+	{2, 206, 136, 0}, {2, 206, 137, 0}, {2, 206, 138, 0}, {2, 194, 187, 0},
+	{2, 206, 140, 0}, {2, 194, 189, 0}, {2, 206, 142, 0}, {2, 206, 143, 0},
+	{2, 206, 144, 0}, {2, 206, 145, 0}, {2, 206, 146, 0}, {2, 206, 147, 0},
+	{2, 206, 148, 0}, {2, 206, 149, 0}, {2, 206, 150, 0}, {2, 206, 151, 0},
+	{2, 206, 152, 0}, {2, 206, 153, 0}, {2, 206, 154, 0}, {2, 206, 155, 0},
+	{2, 206, 156, 0}, {2, 206, 157, 0}, {2, 206, 158, 0}, {2, 206, 159, 0},
+	{2, 206, 160, 0}, {2, 206, 161, 0}, {3, 239, 191, 189}, {2, 206, 163, 0},
+	{2, 206, 164, 0}, {2, 206, 165, 0}, {2, 206, 166, 0}, {2, 206, 167, 0},
+	{2, 206, 168, 0}, {2, 206, 169, 0}, {2, 206, 170, 0}, {2, 206, 171, 0},
+	{2, 206, 172, 0}, {2, 206, 173, 0}, {2, 206, 174, 0}, {2, 206, 175, 0},
+	{2, 206, 176, 0}, {2, 206, 177, 0}, {2, 206, 178, 0}, {2, 206, 179, 0},
+	{2, 206, 180, 0}, {2, 206, 181, 0}, {2, 206, 182, 0}, {2, 206, 183, 0},
+	{2, 206, 184, 0}, {2, 206, 185, 0}, {2, 206, 186, 0}, {2, 206, 187, 0},
+	{2, 206, 188, 0}, {2, 206, 189, 0}, {2, 206, 190, 0}, {2, 206, 191, 0},
+	{2, 207, 128, 0}, {2, 207, 129, 0}, {2, 207, 130, 0}, {2, 207, 131, 0},
+	{2, 207, 132, 0}, {2, 207, 133, 0}, {2, 207, 134, 0}, {2, 207, 135, 0},
+	{2, 207, 136, 0}, {2, 207, 137, 0}, {2, 207, 138, 0}, {2, 207, 139, 0},
+	{2, 207, 140, 0}, {2, 207, 141, 0}, {2, 207, 142, 0}, {3, 239, 191, 189},
+    },
+    // iso-8859-8
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 239, 191, 189}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {2, 194, 165, 0}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 194, 168, 0}, {2, 194, 169, 0}, {2, 195, 151, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 194, 180, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 194, 184, 0}, {2, 194, 185, 0}, {2, 195, 183, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 239, 191, 189}, {3, 239, 191, 189}, {3, 226, 128, 151},
+	{2, 215, 144, 0}, {2, 215, 145, 0}, {2, 215, 146, 0}, {2, 215, 147, 0},
+	{2, 215, 148, 0}, {2, 215, 149, 0}, {2, 215, 150, 0}, {2, 215, 151, 0},
+	{2, 215, 152, 0}, {2, 215, 153, 0}, {2, 215, 154, 0}, {2, 215, 155, 0},
+	{2, 215, 156, 0}, {2, 215, 157, 0}, {2, 215, 158, 0}, {2, 215, 159, 0},
+	{2, 215, 160, 0}, {2, 215, 161, 0}, {2, 215, 162, 0}, {2, 215, 163, 0},
+	{2, 215, 164, 0}, {2, 215, 165, 0}, {2, 215, 166, 0}, {2, 215, 167, 0},
+	{2, 215, 168, 0}, {2, 215, 169, 0}, {2, 215, 170, 0}, {3, 239, 191, 189},
+	{3, 239, 191, 189}, {3, 226, 128, 142}, {3, 226, 128, 143}, {3, 239, 191, 189},
+    },
+    // iso-8859-10
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 196, 132, 0}, {2, 196, 146, 0}, {2, 196, 162, 0},
+	{2, 196, 170, 0}, {2, 196, 168, 0}, {2, 196, 182, 0}, {2, 194, 167, 0},
+	{2, 196, 187, 0}, {2, 196, 144, 0}, {2, 197, 160, 0}, {2, 197, 166, 0},
+	{2, 197, 189, 0}, {2, 194, 173, 0}, {2, 197, 170, 0}, {2, 197, 138, 0},
+	{2, 194, 176, 0}, {2, 196, 133, 0}, {2, 196, 147, 0}, {2, 196, 163, 0},
+	{2, 196, 171, 0}, {2, 196, 169, 0}, {2, 196, 183, 0}, {2, 194, 183, 0},
+	{2, 196, 188, 0}, {2, 196, 145, 0}, {2, 197, 161, 0}, {2, 197, 167, 0},
+	{2, 197, 190, 0}, {3, 226, 128, 149}, {2, 197, 171, 0}, {2, 197, 139, 0},
+	{2, 196, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 196, 174, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 196, 152, 0}, {2, 195, 139, 0},
+	{2, 196, 150, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 195, 144, 0}, {2, 197, 133, 0}, {2, 197, 140, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 197, 168, 0},
+	{2, 195, 152, 0}, {2, 197, 178, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 195, 158, 0}, {2, 195, 159, 0},
+	{2, 196, 129, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 196, 175, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 196, 153, 0}, {2, 195, 171, 0},
+	{2, 196, 151, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 195, 176, 0}, {2, 197, 134, 0}, {2, 197, 141, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 197, 169, 0},
+	{2, 195, 184, 0}, {2, 197, 179, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 195, 190, 0}, {2, 196, 184, 0},
+    },
+    // iso-8859-13
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 226, 128, 157}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{2, 194, 164, 0}, {3, 226, 128, 158}, {2, 194, 166, 0}, {2, 194, 167, 0},
+	{2, 195, 152, 0}, {2, 194, 169, 0}, {2, 197, 150, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 195, 134, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{3, 226, 128, 156}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 195, 184, 0}, {2, 194, 185, 0}, {2, 197, 151, 0}, {2, 194, 187, 0},
+	{2, 194, 188, 0}, {2, 194, 189, 0}, {2, 194, 190, 0}, {2, 195, 166, 0},
+	{2, 196, 132, 0}, {2, 196, 174, 0}, {2, 196, 128, 0}, {2, 196, 134, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 196, 152, 0}, {2, 196, 146, 0},
+	{2, 196, 140, 0}, {2, 195, 137, 0}, {2, 197, 185, 0}, {2, 196, 150, 0},
+	{2, 196, 162, 0}, {2, 196, 182, 0}, {2, 196, 170, 0}, {2, 196, 187, 0},
+	{2, 197, 160, 0}, {2, 197, 131, 0}, {2, 197, 133, 0}, {2, 195, 147, 0},
+	{2, 197, 140, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 197, 178, 0}, {2, 197, 129, 0}, {2, 197, 154, 0}, {2, 197, 170, 0},
+	{2, 195, 156, 0}, {2, 197, 187, 0}, {2, 197, 189, 0}, {2, 195, 159, 0},
+	{2, 196, 133, 0}, {2, 196, 175, 0}, {2, 196, 129, 0}, {2, 196, 135, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 196, 153, 0}, {2, 196, 147, 0},
+	{2, 196, 141, 0}, {2, 195, 169, 0}, {2, 197, 186, 0}, {2, 196, 151, 0},
+	{2, 196, 163, 0}, {2, 196, 183, 0}, {2, 196, 171, 0}, {2, 196, 188, 0},
+	{2, 197, 161, 0}, {2, 197, 132, 0}, {2, 197, 134, 0}, {2, 195, 179, 0},
+	{2, 197, 141, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 197, 179, 0}, {2, 197, 130, 0}, {2, 197, 155, 0}, {2, 197, 171, 0},
+	{2, 195, 188, 0}, {2, 197, 188, 0}, {2, 197, 190, 0}, {3, 226, 128, 153},
+    },
+    // iso-8859-14
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {3, 225, 184, 130}, {3, 225, 184, 131}, {2, 194, 163, 0},
+	{2, 196, 138, 0}, {2, 196, 139, 0}, {3, 225, 184, 138}, {2, 194, 167, 0},
+	{3, 225, 186, 128}, {2, 194, 169, 0}, {3, 225, 186, 130}, {3, 225, 184, 139},
+	{3, 225, 187, 178}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 197, 184, 0},
+	{3, 225, 184, 158}, {3, 225, 184, 159}, {2, 196, 160, 0}, {2, 196, 161, 0},
+	{3, 225, 185, 128}, {3, 225, 185, 129}, {2, 194, 182, 0}, {3, 225, 185, 150},
+	{3, 225, 186, 129}, {3, 225, 185, 151}, {3, 225, 186, 131}, {3, 225, 185, 160},
+	{3, 225, 187, 179}, {3, 225, 186, 132}, {3, 225, 186, 133}, {3, 225, 185, 161},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 197, 180, 0}, {2, 195, 145, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {3, 225, 185, 170},
+	{2, 195, 152, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 197, 182, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 197, 181, 0}, {2, 195, 177, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {3, 225, 185, 171},
+	{2, 195, 184, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 197, 183, 0}, {2, 195, 191, 0},
+    },
+    // iso-8859-15
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 194, 161, 0}, {2, 194, 162, 0}, {2, 194, 163, 0},
+	{3, 226, 130, 172}, {2, 194, 165, 0}, {2, 197, 160, 0}, {2, 194, 167, 0},
+	{2, 197, 161, 0}, {2, 194, 169, 0}, {2, 194, 170, 0}, {2, 194, 171, 0},
+	{2, 194, 172, 0}, {2, 194, 173, 0}, {2, 194, 174, 0}, {2, 194, 175, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 194, 178, 0}, {2, 194, 179, 0},
+	{2, 197, 189, 0}, {2, 194, 181, 0}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 197, 190, 0}, {2, 194, 185, 0}, {2, 194, 186, 0}, {2, 194, 187, 0},
+	{2, 197, 146, 0}, {2, 197, 147, 0}, {2, 197, 184, 0}, {2, 194, 191, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 195, 131, 0},
+	{2, 195, 132, 0}, {2, 195, 133, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 195, 144, 0}, {2, 195, 145, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 195, 149, 0}, {2, 195, 150, 0}, {2, 195, 151, 0},
+	{2, 195, 152, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 195, 157, 0}, {2, 195, 158, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 195, 163, 0},
+	{2, 195, 164, 0}, {2, 195, 165, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 195, 176, 0}, {2, 195, 177, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 195, 181, 0}, {2, 195, 182, 0}, {2, 195, 183, 0},
+	{2, 195, 184, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 195, 189, 0}, {2, 195, 190, 0}, {2, 195, 191, 0},
+    },
+    // iso-8859-16
+    {
+	{2, 194, 128, 0}, {2, 194, 129, 0}, {2, 194, 130, 0}, {2, 194, 131, 0},
+	{2, 194, 132, 0}, {2, 194, 133, 0}, {2, 194, 134, 0}, {2, 194, 135, 0},
+	{2, 194, 136, 0}, {2, 194, 137, 0}, {2, 194, 138, 0}, {2, 194, 139, 0},
+	{2, 194, 140, 0}, {2, 194, 141, 0}, {2, 194, 142, 0}, {2, 194, 143, 0},
+	{2, 194, 144, 0}, {2, 194, 145, 0}, {2, 194, 146, 0}, {2, 194, 147, 0},
+	{2, 194, 148, 0}, {2, 194, 149, 0}, {2, 194, 150, 0}, {2, 194, 151, 0},
+	{2, 194, 152, 0}, {2, 194, 153, 0}, {2, 194, 154, 0}, {2, 194, 155, 0},
+	{2, 194, 156, 0}, {2, 194, 157, 0}, {2, 194, 158, 0}, {2, 194, 159, 0},
+	{2, 194, 160, 0}, {2, 196, 132, 0}, {2, 196, 133, 0}, {2, 197, 129, 0},
+	{3, 226, 130, 172}, {3, 226, 128, 158}, {2, 197, 160, 0}, {2, 194, 167, 0},
+	{2, 197, 161, 0}, {2, 194, 169, 0}, {2, 200, 152, 0}, {2, 194, 171, 0},
+	{2, 197, 185, 0}, {2, 194, 173, 0}, {2, 197, 186, 0}, {2, 197, 187, 0},
+	{2, 194, 176, 0}, {2, 194, 177, 0}, {2, 196, 140, 0}, {2, 197, 130, 0},
+	{2, 197, 189, 0}, {3, 226, 128, 157}, {2, 194, 182, 0}, {2, 194, 183, 0},
+	{2, 197, 190, 0}, {2, 196, 141, 0}, {2, 200, 153, 0}, {2, 194, 187, 0},
+	{2, 197, 146, 0}, {2, 197, 147, 0}, {2, 197, 184, 0}, {2, 197, 188, 0},
+	{2, 195, 128, 0}, {2, 195, 129, 0}, {2, 195, 130, 0}, {2, 196, 130, 0},
+	{2, 195, 132, 0}, {2, 196, 134, 0}, {2, 195, 134, 0}, {2, 195, 135, 0},
+	{2, 195, 136, 0}, {2, 195, 137, 0}, {2, 195, 138, 0}, {2, 195, 139, 0},
+	{2, 195, 140, 0}, {2, 195, 141, 0}, {2, 195, 142, 0}, {2, 195, 143, 0},
+	{2, 196, 144, 0}, {2, 197, 131, 0}, {2, 195, 146, 0}, {2, 195, 147, 0},
+	{2, 195, 148, 0}, {2, 197, 144, 0}, {2, 195, 150, 0}, {2, 197, 154, 0},
+	{2, 197, 176, 0}, {2, 195, 153, 0}, {2, 195, 154, 0}, {2, 195, 155, 0},
+	{2, 195, 156, 0}, {2, 196, 152, 0}, {2, 200, 154, 0}, {2, 195, 159, 0},
+	{2, 195, 160, 0}, {2, 195, 161, 0}, {2, 195, 162, 0}, {2, 196, 131, 0},
+	{2, 195, 164, 0}, {2, 196, 135, 0}, {2, 195, 166, 0}, {2, 195, 167, 0},
+	{2, 195, 168, 0}, {2, 195, 169, 0}, {2, 195, 170, 0}, {2, 195, 171, 0},
+	{2, 195, 172, 0}, {2, 195, 173, 0}, {2, 195, 174, 0}, {2, 195, 175, 0},
+	{2, 196, 145, 0}, {2, 197, 132, 0}, {2, 195, 178, 0}, {2, 195, 179, 0},
+	{2, 195, 180, 0}, {2, 197, 145, 0}, {2, 195, 182, 0}, {2, 197, 155, 0},
+	{2, 197, 177, 0}, {2, 195, 185, 0}, {2, 195, 186, 0}, {2, 195, 187, 0},
+	{2, 195, 188, 0}, {2, 196, 153, 0}, {2, 200, 155, 0}, {2, 195, 191, 0},
+    },
+    // koi8-r
+    {
+	{3, 226, 148, 128}, {3, 226, 148, 130}, {3, 226, 148, 140}, {3, 226, 148, 144},
+	{3, 226, 148, 148}, {3, 226, 148, 152}, {3, 226, 148, 156}, {3, 226, 148, 164},
+	{3, 226, 148, 172}, {3, 226, 148, 180}, {3, 226, 148, 188}, {3, 226, 150, 128},
+	{3, 226, 150, 132}, {3, 226, 150, 136}, {3, 226, 150, 140}, {3, 226, 150, 144},
+	{3, 226, 150, 145}, {3, 226, 150, 146}, {3, 226, 150, 147}, {3, 226, 140, 160},
+	{3, 226, 150, 160}, {3, 226, 136, 153}, {3, 226, 136, 154}, {3, 226, 137, 136},
+	{3, 226, 137, 164}, {3, 226, 137, 165}, {2, 194, 160, 0}, {3, 226, 140, 161},
+	{2, 194, 176, 0}, {2, 194, 178, 0}, {2, 194, 183, 0}, {2, 195, 183, 0},
+	{3, 226, 149, 144}, {3, 226, 149, 145}, {3, 226, 149, 146}, {2, 209, 145, 0},
+	{3, 226, 149, 147}, {3, 226, 149, 148}, {3, 226, 149, 149}, {3, 226, 149, 150},
+	{3, 226, 149, 151}, {3, 226, 149, 152}, {3, 226, 149, 153}, {3, 226, 149, 154},
+	{3, 226, 149, 155}, {3, 226, 149, 156}, {3, 226, 149, 157}, {3, 226, 149, 158},
+	{3, 226, 149, 159}, {3, 226, 149, 160}, {3, 226, 149, 161}, {2, 208, 129, 0},
+	{3, 226, 149, 162}, {3, 226, 149, 163}, {3, 226, 149, 164}, {3, 226, 149, 165},
+	{3, 226, 149, 166}, {3, 226, 149, 167}, {3, 226, 149, 168}, {3, 226, 149, 169},
+	{3, 226, 149, 170}, {3, 226, 149, 171}, {3, 226, 149, 172}, {2, 194, 169, 0},
+	{2, 209, 142, 0}, {2, 208, 176, 0}, {2, 208, 177, 0}, {2, 209, 134, 0},
+	{2, 208, 180, 0}, {2, 208, 181, 0}, {2, 209, 132, 0}, {2, 208, 179, 0},
+	{2, 209, 133, 0}, {2, 208, 184, 0}, {2, 208, 185, 0}, {2, 208, 186, 0},
+	{2, 208, 187, 0}, {2, 208, 188, 0}, {2, 208, 189, 0}, {2, 208, 190, 0},
+	{2, 208, 191, 0}, {2, 209, 143, 0}, {2, 209, 128, 0}, {2, 209, 129, 0},
+	{2, 209, 130, 0}, {2, 209, 131, 0}, {2, 208, 182, 0}, {2, 208, 178, 0},
+	{2, 209, 140, 0}, {2, 209, 139, 0}, {2, 208, 183, 0}, {2, 209, 136, 0},
+	{2, 209, 141, 0}, {2, 209, 137, 0}, {2, 209, 135, 0}, {2, 209, 138, 0},
+	{2, 208, 174, 0}, {2, 208, 144, 0}, {2, 208, 145, 0}, {2, 208, 166, 0},
+	{2, 208, 148, 0}, {2, 208, 149, 0}, {2, 208, 164, 0}, {2, 208, 147, 0},
+	{2, 208, 165, 0}, {2, 208, 152, 0}, {2, 208, 153, 0}, {2, 208, 154, 0},
+	{2, 208, 155, 0}, {2, 208, 156, 0}, {2, 208, 157, 0}, {2, 208, 158, 0},
+	{2, 208, 159, 0}, {2, 208, 175, 0}, {2, 208, 160, 0}, {2, 208, 161, 0},
+	{2, 208, 162, 0}, {2, 208, 163, 0}, {2, 208, 150, 0}, {2, 208, 146, 0},
+	{2, 208, 172, 0}, {2, 208, 171, 0}, {2, 208, 151, 0}, {2, 208, 168, 0},
+	{2, 208, 173, 0}, {2, 208, 169, 0}, {2, 208, 167, 0}, {2, 208, 170, 0},
+    },
+    // koi8-u
+    {
+	{3, 226, 148, 128}, {3, 226, 148, 130}, {3, 226, 148, 140}, {3, 226, 148, 144},
+	{3, 226, 148, 148}, {3, 226, 148, 152}, {3, 226, 148, 156}, {3, 226, 148, 164},
+	{3, 226, 148, 172}, {3, 226, 148, 180}, {3, 226, 148, 188}, {3, 226, 150, 128},
+	{3, 226, 150, 132}, {3, 226, 150, 136}, {3, 226, 150, 140}, {3, 226, 150, 144},
+	{3, 226, 150, 145}, {3, 226, 150, 146}, {3, 226, 150, 147}, {3, 226, 140, 160},
+	{3, 226, 150, 160}, {3, 226, 136, 153}, {3, 226, 136, 154}, {3, 226, 137, 136},
+	{3, 226, 137, 164}, {3, 226, 137, 165}, {2, 194, 160, 0}, {3, 226, 140, 161},
+	{2, 194, 176, 0}, {2, 194, 178, 0}, {2, 194, 183, 0}, {2, 195, 183, 0},
+	{3, 226, 149, 144}, {3, 226, 149, 145}, {3, 226, 149, 146}, {2, 209, 145, 0},
+	{2, 209, 148, 0}, {3, 226, 149, 148}, {2, 209, 150, 0}, {2, 209, 151, 0},
+	{3, 226, 149, 151}, {3, 226, 149, 152}, {3, 226, 149, 153}, {3, 226, 149, 154},
+	{3, 226, 149, 155}, {2, 210, 145, 0}, {3, 226, 149, 157}, {3, 226, 149, 158},
+	{3, 226, 149, 159}, {3, 226, 149, 160}, {3, 226, 149, 161}, {2, 208, 129, 0},
+	{2, 208, 132, 0}, {3, 226, 149, 163}, {2, 208, 134, 0}, {2, 208, 135, 0},
+	{3, 226, 149, 166}, {3, 226, 149, 167}, {3, 226, 149, 168}, {3, 226, 149, 169},
+	{3, 226, 149, 170}, {2, 210, 144, 0}, {3, 226, 149, 172}, {2, 194, 169, 0},
+	{2, 209, 142, 0}, {2, 208, 176, 0}, {2, 208, 177, 0}, {2, 209, 134, 0},
+	{2, 208, 180, 0}, {2, 208, 181, 0}, {2, 209, 132, 0}, {2, 208, 179, 0},
+	{2, 209, 133, 0}, {2, 208, 184, 0}, {2, 208, 185, 0}, {2, 208, 186, 0},
+	{2, 208, 187, 0}, {2, 208, 188, 0}, {2, 208, 189, 0}, {2, 208, 190, 0},
+	{2, 208, 191, 0}, {2, 209, 143, 0}, {2, 209, 128, 0}, {2, 209, 129, 0},
+	{2, 209, 130, 0}, {2, 209, 131, 0}, {2, 208, 182, 0}, {2, 208, 178, 0},
+	{2, 209, 140, 0}, {2, 209, 139, 0}, {2, 208, 183, 0}, {2, 209, 136, 0},
+	{2, 209, 141, 0}, {2, 209, 137, 0}, {2, 209, 135, 0}, {2, 209, 138, 0},
+	{2, 208, 174, 0}, {2, 208, 144, 0}, {2, 208, 145, 0}, {2, 208, 166, 0},
+	{2, 208, 148, 0}, {2, 208, 149, 0}, {2, 208, 164, 0}, {2, 208, 147, 0},
+	{2, 208, 165, 0}, {2, 208, 152, 0}, {2, 208, 153, 0}, {2, 208, 154, 0},
+	{2, 208, 155, 0}, {2, 208, 156, 0}, {2, 208, 157, 0}, {2, 208, 158, 0},
+	{2, 208, 159, 0}, {2, 208, 175, 0}, {2, 208, 160, 0}, {2, 208, 161, 0},
+	{2, 208, 162, 0}, {2, 208, 163, 0}, {2, 208, 150, 0}, {2, 208, 146, 0},
+	{2, 208, 172, 0}, {2, 208, 171, 0}, {2, 208, 151, 0}, {2, 208, 168, 0},
+	{2, 208, 173, 0}, {2, 208, 169, 0}, {2, 208, 167, 0}, {2, 208, 170, 0},
+    },
+};
+
+// The normalised labels, and the table each one uses.
+static const char * const charset_labels[CHARSET_LABELS] = {
+    "ansix341968",
+    "arabic",
+    "ascii",
+    "asmo708",
+    "cp1250",
+    "cp1251",
+    "cp1252",
+    "cp1253",
+    "cp1254",
+    "cp1255",
+    "cp1256",
+    "cp1257",
+    "cp1258",
+    "cp819",
+    "csiso88596e",
+    "csiso88596i",
+    "csiso88598e",
+    "csiso88598i",
+    "csisolatin1",
+    "csisolatin2",
+    "csisolatin3",
+    "csisolatin4",
+    "csisolatin5",
+    "csisolatin6",
+    "csisolatin9",
+    "csisolatinarabic",
+    "csisolatincyrillic",
+    "csisolatingreek",
+    "csisolatinhebrew",
+    "cskoi8r",
+    "cyrillic",
+    "dos874",
+    "ecma114",
+    "ecma118",
+    "elot928",
+    "greek",
+    "greek8",
+    "hebrew",
+    "ibm819",
+    "iso88591",
+    "iso885910",
+    "iso885911",
+    "iso885913",
+    "iso885914",
+    "iso885915",
+    "iso885916",
+    "iso88591:1987",
+    "iso88592",
+    "iso88592:1987",
+    "iso88593",
+    "iso88593:1988",
+    "iso88594",
+    "iso88594:1988",
+    "iso88595",
+    "iso88595:1988",
+    "iso88596",
+    "iso88596:1987",
+    "iso88596e",
+    "iso88596i",
+    "iso88597",
+    "iso88597:1987",
+    "iso88598",
+    "iso88598:1988",
+    "iso88598e",
+    "iso88598i",
+    "iso88599",
+    "iso88599:1989",
+    "isoir100",
+    "isoir101",
+    "isoir109",
+    "isoir110",
+    "isoir126",
+    "isoir127",
+    "isoir138",
+    "isoir144",
+    "isoir148",
+    "isoir157",
+    "koi",
+    "koi8",
+    "koi8r",
+    "koi8ru",
+    "koi8u",
+    "l1",
+    "l2",
+    "l3",
+    "l4",
+    "l5",
+    "l6",
+    "l9",
+    "latin1",
+    "latin10",
+    "latin2",
+    "latin3",
+    "latin4",
+    "latin5",
+    "latin6",
+    "latin9",
+    "logical",
+    "suneugreek",
+    "tis620",
+    "usascii",
+    "visual",
+    "windows1250",
+    "windows1251",
+    "windows1252",
+    "windows1253",
+    "windows1254",
+    "windows1255",
+    "windows1256",
+    "windows1257",
+    "windows1258",
+    "windows874",
+    "xcp1250",
+    "xcp1251",
+    "xcp1252",
+    "xcp1253",
+    "xcp1254",
+    "xcp1255",
+    "xcp1256",
+    "xcp1257",
+    "xcp1258",
+};
+
+static const unsigned char charset_label_tables[CHARSET_LABELS] = {
+    3, 14, 3, 14, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 3, 14, 14, 16, 16, 3, 10, 11, 12, 5, 17,
+    20, 14, 13, 15, 16, 22, 13, 0, 14, 15, 15, 15,
+    15, 16, 3, 3, 17, 0, 18, 19, 20, 21, 3, 10,
+    10, 11, 11, 12, 12, 13, 13, 14, 14, 14, 14, 15,
+    15, 16, 16, 16, 16, 5, 5, 3, 10, 11, 12, 15,
+    14, 16, 13, 5, 17, 22, 22, 22, 23, 23, 3, 10,
+    11, 12, 5, 17, 20, 3, 21, 10, 11, 12, 5, 17,
+    20, 16, 15, 0, 3, 16, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9,
+};
+
+static const unsigned short charset_displacements[CHARSET_BUCKETS] = {
+    1, 3, 8, 3, 2, 1, 2, 4, 4, 1, 2, 2,
+    2, 1, 0, 1, 2, 1, 1, 1, 2, 2, 3, 3,
+    3, 1, 0, 1, 1, 1, 2, 2, 1, 2, 2, 2,
+    0, 0, 1, 1, 3, 2, 4, 1, 1, 0, 1, 4,
+    0, 0, 0, 0, 0, 2, 1, 7, 2, 2, 1, 2,
+};
+
+// Index of the label stored in each slot, plus one (0 for an empty slot).
+static const unsigned char charset_slots[CHARSET_SLOTS] = {
+    0, 108, 95, 22, 33, 0, 28, 0, 60, 72, 36, 0,
+    38, 0, 82, 41, 63, 42, 0, 74, 65, 113, 0, 0,
+    51, 0, 0, 0, 0, 13, 0, 112, 34, 4, 0, 0,
+    99, 0, 77, 100, 0, 24, 0, 0, 0, 0, 54, 20,
+    64, 0, 0, 0, 0, 0, 98, 87, 0, 67, 116, 0,
+    0, 48, 0, 0, 0, 0, 71, 104, 0, 0, 52, 23,
+    109, 81, 0, 0, 0, 0, 97, 0, 0, 0, 0, 78,
+    0, 0, 9, 85, 0, 0, 11, 114, 0, 45, 47, 35,
+    10, 0, 0, 25, 0, 3, 0, 17, 0, 0, 0, 0,
+    0, 0, 107, 0, 0, 79, 0, 111, 0, 62, 73, 6,
+    101, 0, 0, 0, 7, 83, 26, 93, 80, 31, 0, 18,
+    40, 32, 12, 0, 0, 0, 0, 102, 29, 0, 0, 0,
+    15, 0, 68, 0, 105, 0, 0, 0, 89, 0, 0, 56,
+    21, 0, 106, 37, 96, 16, 1, 119, 86, 75, 39, 118,
+    0, 0, 0, 55, 0, 121, 0, 0, 103, 0, 46, 0,
+    0, 0, 90, 0, 0, 0, 0, 70, 0, 66, 27, 0,
+    0, 57, 19, 44, 84, 0, 94, 0, 0, 117, 88, 0,
+    8, 120, 0, 0, 0, 0, 53, 0, 0, 30, 0, 0,
+    0, 0, 58, 0, 69, 0, 0, 0, 0, 0, 14, 0,
+    5, 0, 0, 2, 0, 61, 110, 43, 92, 0, 115, 0,
+    0, 76, 91, 0, 0, 0, 59, 0, 0, 0, 0, 0,
+    0, 49, 0, 50,
+};
+
+const SingleByteTable *
+single_byte_charset(const char *name, size_t len)
+{
+    char buf[CHARSET_MAX_LABEL_LEN];
+    size_t n = 0;
+    for (size_t i = 0; i != len; ++i) {
+	char ch = name[i];
+	if (ch == ' ' || ch == '-' || ch == '_' || ch == '.') continue;
+	if (n == sizeof(buf)) return NULL;
+	buf[n++] = tolower(static_cast<unsigned char>(ch));
+    }
+    unsigned d = charset_displacements[perfect_hash(0, buf, n) % CHARSET_BUCKETS];
+    unsigned i = charset_slots[perfect_hash(d, buf, n) & (CHARSET_SLOTS - 1)];
+    if (i == 0) return NULL;
+    const char * label = charset_labels[i - 1];
+    if (strlen(label) != n || memcmp(label, buf, n) != 0) return NULL;
+    return &charset_tables[charset_label_tables[i - 1]];
+}
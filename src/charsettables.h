@@ -0,0 +1,25 @@
+/* charsettables.h: tables for converting single-byte character sets.
+ *
+ * This file is automatically generated by configutils/gencharsets.py
+ */
+
+#ifndef OMEGA_INCLUDED_CHARSETTABLES_H
+#define OMEGA_INCLUDED_CHARSETTABLES_H
+
+#include <stddef.h>
+
+/** How to convert bytes 0x80 to 0xff of a single-byte character set.
+ *
+ *  Entry i is for byte 0x80 + i: the length of its UTF-8 form, then the
+ *  (up to three) bytes of it.  Bytes below 0x80 are ASCII.
+ */
+typedef unsigned char SingleByteTable[128][4];
+
+/** Look up the table for a single-byte character set.
+ *
+ *  Case, spaces, '-', '_' and '.' in the name are ignored.  Returns NULL if
+ *  there's no table for the character set.
+ */
+const SingleByteTable * single_byte_charset(const char *name, size_t len);
+
+#endif // OMEGA_INCLUDED_CHARSETTABLES_H
@@ -4,7 +4,7 @@
  */
 
 /* Define to 1 if iconv() should be used for converting character sets. */
-#undef USE_ICONV
+#define USE_ICONV 1
 
 /* Define to 1 if you have the <sys/errno.h> header file. */
 #define HAVE_SYS_ERRNO_H 1
@@ -15,5 +15,8 @@
 /* Define to 1 if you have the <strings.h> header file. */
 #define HAVE_STRINGS_H 1
 
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#define HAVE_SYS_MMAN_H 1
+
 /* The name of this package. */
 #define PACKAGE htmlparser
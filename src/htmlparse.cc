@@ -32,378 +32,735 @@ using std::find_if;
 #include <string.h>
 #include <ctype.h>
 
+#include "charscan.h"
 #include "htmlparse.h"
+#include "namedentities.h"
+#include "sniffcharset.h"
+#include "strcasecmp.h"
 #include "utf8convert.h"
 
-typedef map<string, unsigned int> NamedEntityMap;
-NamedEntityMap HtmlParser::named_ents;
-
 inline static bool
-p_notdigit(char c)
+p_notwhitespace(char c)
 {
-    return !isdigit(static_cast<unsigned char>(c));
+    return !isspace(static_cast<unsigned char>(c));
 }
 
 inline static bool
-p_notxdigit(char c)
+p_nottag(char c)
 {
-    return !isxdigit(static_cast<unsigned char>(c));
+    return !isalnum(static_cast<unsigned char>(c)) &&
+    c != '.' && c != '-' && c != ':'; // ':' for XML namespaces.
 }
 
-inline static bool
-p_notalnum(char c)
+// Parse a character reference, with p pointing just after the '&'.
+// Returns the number of code points the reference stands for (0, 1 or 2)
+// and sets next to point after it, or returns -1 if p doesn't start a
+// reference.
+static int
+parse_reference(const char *p, const char *end, const char *&next,
+		unsigned cp[2])
 {
-    return !isalnum(static_cast<unsigned char>(c));
+    if (p != end && *p == '#') {
+	const char * d = p + 1;
+	bool hex = (d != end && (*d == 'x' || *d == 'X'));
+	if (hex) ++d;
+	const char * e = d;
+	unsigned val = 0;
+	for ( ; e != end; ++e) {
+	    unsigned ch = static_cast<unsigned char>(*e);
+	    unsigned digit = ch - '0';
+	    if (digit >= 10) {
+		if (!hex) break;
+		digit = (ch | 0x20) - 'a';
+		if (digit >= 6) break;
+		digit += 10;
+	    }
+	    // Stop accumulating once out of range, so we can't overflow.
+	    if (val <= 0x10ffff) val = val * (hex ? 16 : 10) + digit;
+	}
+	if (e == d) return -1;
+	next = e;
+	if (next != end && *next == ';') ++next;
+	if (val == 0) return 0;
+	if (val > 0x10ffff || (val >= 0xd800 && val <= 0xdfff)) val = 0xfffd;
+	cp[0] = val;
+	return 1;
+    }
+
+    const char * e = p;
+    while (e != end && isalnum(static_cast<unsigned char>(*e))) ++e;
+    size_t len = e - p;
+    if (len && e != end && *e == ';') {
+	int n = named_entity_lookup(p, len + 1, cp);
+	if (n) {
+	    next = e + 1;
+	    return n;
+	}
+    }
+    // Some legacy names are recognised without a ';', and the longest such
+    // name which prefixes the text is used.
+    if (len > NAMED_ENTITY_MAX_LEGACY_LEN) len = NAMED_ENTITY_MAX_LEGACY_LEN;
+    for ( ; len >= 2; --len) {
+	int n = named_entity_lookup(p, len, cp);
+	if (n) {
+	    next = p + len;
+	    return n;
+	}
+    }
+    return -1;
 }
 
-inline static bool
-p_notwhitespace(char c)
+void
+HtmlParser::decode_entities(string &s)
 {
-    return !isspace(static_cast<unsigned char>(c));
+    /* Decodes entities in place, in s.
+     *
+     * The decoded form of a reference is never longer than the reference,
+     * except for &nGt; and &nLt; (which decode to two code points), so we
+     * write the output behind the read position and only need to make room
+     * in those two cases.  Anything which isn't a valid reference is left
+     * as it is.
+     */
+    string::size_type r = s.find('&');
+    if (r == string::npos) return;
+    string::size_type w = r;
+
+    while (true) {
+	// s[r] is '&'.
+	const char * next;
+	unsigned cp[2];
+	int n = parse_reference(s.data() + r + 1, s.data() + s.size(), next, cp);
+	if (n < 0) {
+	    s[w++] = s[r++];
+	} else {
+	    string::size_type e = next - s.data();
+	    char seq[8];
+	    unsigned len = 0;
+	    for (int i = 0; i != n; ++i)
+		len += Xapian::Unicode::to_utf8(cp[i], seq + len);
+	    if (len > e - w) {
+		string::size_type extra = len - (e - w);
+		s.insert(e, extra, '\0');
+		e += extra;
+	    }
+	    memcpy(&s[w], seq, len);
+	    w += len;
+	    r = e;
+	}
+
+	string::size_type amp = s.find('&', r);
+	if (amp == string::npos) amp = s.size();
+	if (w != r) memmove(&s[w], s.data() + r, amp - r);
+	w += amp - r;
+	r = amp;
+	if (r == s.size()) break;
+    }
+
+    s.resize(w);
 }
 
-inline static bool
-p_nottag(char c)
+static inline bool
+is_collapsed_space(unsigned ch)
 {
-    return !isalnum(static_cast<unsigned char>(c)) &&
-    c != '.' && c != '-' && c != ':'; // ':' for XML namespaces.
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
 }
 
-inline static bool
-p_whitespacegt(char c)
+// Is ch a Unicode space separator other than ' '?
+static inline bool
+is_unicode_space(unsigned ch)
 {
-    return isspace(static_cast<unsigned char>(c)) || c == '>';
+    return ch == 0xa0 || ch == 0x1680 || (ch >= 0x2000 && ch <= 0x200a) ||
+	   ch == 0x202f || ch == 0x205f || ch == 0x3000;
 }
 
-inline static bool
-p_whitespaceeqgt(char c)
+// Return the length of the UTF-8 encoded Unicode space separator at p, or 0
+// if there isn't one.
+static size_t
+unicode_space_len(const char *p, const char *end)
 {
-    return isspace(static_cast<unsigned char>(c)) || c == '=' || c == '>';
+    const unsigned char * u = reinterpret_cast<const unsigned char *>(p);
+    size_t len = end - p;
+    if (len >= 2 && u[0] == 0xc2 && u[1] == 0xa0) return 2;
+    if (len < 3) return 0;
+    switch (u[0]) {
+	case 0xe1:
+	    return (u[1] == 0x9a && u[2] == 0x80) ? 3 : 0;
+	case 0xe2:
+	    if (u[1] == 0x80)
+		return ((u[2] >= 0x80 && u[2] <= 0x8a) || u[2] == 0xaf) ? 3 : 0;
+	    return (u[1] == 0x81 && u[2] == 0x9f) ? 3 : 0;
+	case 0xe3:
+	    return (u[1] == 0x80 && u[2] == 0x80) ? 3 : 0;
+	default:
+	    return 0;
+    }
 }
 
-HtmlParser::HtmlParser()
+void
+HtmlParser::append_collapsed(string &out, const StringView &text,
+			     bool decode, bool &pending_space,
+			     bool unicode_spaces)
 {
-    static const struct ent { const char *n; unsigned int v; } ents[] = {
-#include "namedentities.h"
-    { NULL, 0 }
-    };
-    if (named_ents.empty()) {
-    const struct ent *i = ents;
-    while (i->n) {
-        named_ents[string(i->n)] = i->v;
-        ++i;
-    }
+    const char * p = text.data();
+    const char * const end = p + text.size();
+    // When not decoding, scan for ' ' in place of '&' so it isn't special.
+    const char stop = decode ? '&' : ' ';
+    while (p != end) {
+	// Find the end of the run of ordinary characters, looking through
+	// any '&' which doesn't start a reference.
+	const char * q = p;
+	const char * next = NULL;
+	unsigned cp[2];
+	int n = -1;
+	size_t space_len = 1;
+	while (true) {
+	    if (unicode_spaces) {
+		q = charscan(q, end, ScanUnicodeSpaceOr(stop));
+	    } else {
+		q = charscan(q, end, ScanSpaceOr(stop));
+	    }
+	    if (q == end) break;
+	    if (*q == '&') {
+		n = parse_reference(q + 1, end, next, cp);
+		if (n >= 0) break;
+	    } else if (is_collapsed_space(*q)) {
+		break;
+	    } else if (unicode_spaces &&
+		       (space_len = unicode_space_len(q, end)) != 0) {
+		break;
+	    }
+	    // A '&' which isn't a reference, '\v' or '\f', or a non-space
+	    // character starting with a byte like a Unicode space's.
+	    space_len = 1;
+	    ++q;
+	}
+
+	if (q != p) {
+	    if (pending_space && !out.empty()) out += ' ';
+	    pending_space = false;
+	    out.append(p, q - p);
+	    if (q == end) break;
+	}
+
+	if (n < 0) {
+	    // Whitespace.
+	    pending_space = true;
+	    p = q + space_len;
+	    continue;
+	}
+
+	for (int i = 0; i != n; ++i) {
+	    if (is_collapsed_space(cp[i]) ||
+		(unicode_spaces && is_unicode_space(cp[i]))) {
+		pending_space = true;
+		continue;
+	    }
+	    if (pending_space && !out.empty()) out += ' ';
+	    pending_space = false;
+	    char seq[4];
+	    out.append(seq, Xapian::Unicode::to_utf8(cp[i], seq));
+	}
+	p = next;
     }
 }
 
 void
-HtmlParser::decode_entities(string &s)
+HtmlParser::process_undecoded_text(const StringView &text, bool has_amp)
 {
-    /* Decodes entities in place, in s */
-
-    typedef std::string::iterator char_iter;
-    typedef std::iterator_traits<char_iter>::value_type char_type;
+    if (!has_amp) {
+	process_text_view(text);
+	return;
+    }
+    if (text.data() != text_buf.data())
+	text_buf.assign(text.data(), text.size());
+    decode_entities(text_buf);
+    process_text_view(text_buf);
+}
 
-    char_iter begin = std::find(s.begin(), s.end(), '&');
-    char_iter entity_end = s.end();
-    char_iter writer = begin;
+bool
+HtmlAttributes::add(const char *name, size_t len, const StringView &value)
+{
+    size_t start = names.size();
+    names.append(name, len);
+    for (string::iterator i = names.begin() + start; i != names.end(); ++i)
+	*i = tolower(static_cast<unsigned char>(*i));
+
+    StringView lower(names.data() + start, len);
+    std::vector<Attr>::const_iterator i;
+    for (i = attrs.begin(); i != attrs.end(); ++i) {
+	if (i->name_len == len &&
+	    memcmp(names.data() + i->name_start, lower.data(), len) == 0) {
+	    names.resize(start);
+	    return false;
+	}
+    }
+    attrs.push_back(Attr(start, len, value));
+    return true;
+}
 
-    while (begin != s.end())
-    {
-        unsigned int val = 0;
+const StringView *
+HtmlAttributes::find(const StringView &name) const
+{
+    std::vector<Attr>::const_iterator i;
+    for (i = attrs.begin(); i != attrs.end(); ++i) {
+	if (i->name_len == name.size() &&
+	    memcmp(names.data() + i->name_start, name.data(), name.size()) == 0)
+	    return &i->value;
+    }
+    return NULL;
+}
 
-        if (begin == s.end())
-            break;
+bool
+HtmlParser::opening_tag_view(const StringView &tag, HtmlTagId,
+			     const HtmlAttributes &a)
+{
+    map<string, string> p;
+    for (size_t i = 0; i != a.size(); ++i)
+	p[a.name(i).str()] = a.value(i).str();
+    return opening_tag(tag.str(), p);
+}
 
-        char_iter entity(begin);
-        std::advance(entity, 1);
+StringView
+HtmlParser::lowercase_tag(const char *p, const char *end)
+{
+    // Most tag names are already lowercase, so only copy those which aren't.
+    const char *i = p;
+    while (i != end && !isupper(static_cast<unsigned char>(*i))) ++i;
+    if (i == end) return StringView(p, end - p);
+
+    tag_buf.assign(p, end - p);
+    for (string::iterator j = tag_buf.begin() + (i - p); j != tag_buf.end(); ++j)
+	*j = tolower(static_cast<unsigned char>(*j));
+    return StringView(tag_buf);
+}
 
-        if (entity == s.end())
-            break;
+void
+HtmlParser::parse_html(const string &body)
+{
+    parse_html(body.data(), body.size());
+}
 
-        // It's a number'd entity
-        if (*entity == '#')
-        {
-            std::advance(entity, 1);
+void
+HtmlParser::reset()
+{
+    in_script = false;
+    raw_text_id = TAG_UNKNOWN;
+    stopped = false;
+    converter.reset();
+    pending.resize(0);
+    consumed = 0;
+    retry_size = 0;
+    started = false;
+}
 
-            if (entity == s.end())
-                break;
+void
+HtmlParser::parse_html(const char *data, size_t len)
+{
+    HtmlParser::reset();
+    size_t bom = start_document(data, len);
+    parse_chunk(data + bom, data + len, true);
+}
 
-            // Hex
-            if (*entity == 'x' || *entity == 'X')
-            {
-                std::advance(entity, 1); // skip the x
-                // Optimization: Swapping in a null byte for sscanf and putting it back
-                entity_end = std::find_if(entity, s.end(), p_notxdigit);
-                char_type backup = *entity_end;
-                *entity_end = '\0';
-
-                // Super ugly cast
-                sscanf(&*(entity), "%x", &val);
-                *entity_end = backup;
-            }
-            // Decimal
-            else
-            {
-                // Optimization: Swapping in a null byte for sscanf and putting it back
-                entity_end = std::find_if(entity, s.end(), p_notdigit);
-                char_type backup = *entity_end;
-                *entity_end = '\0';
-
-                // Super ugly cast
-                val = atoi(&*(entity));
-                *entity_end = backup;
-            }
-        }
-        // It's a named entity
-        else
-        {
-            entity_end = std::find_if(entity, s.end(), p_notalnum);
-            // Doh, gotta copy to lookup in named_ents
-            const std::string name(entity, entity_end);
-            NamedEntityMap::const_iterator iter = named_ents.find(name);
-
-            if (iter != named_ents.end())
-                val = iter->second;
-        }
+size_t
+HtmlParser::start_document(const char *data, size_t len)
+{
+    started = true;
+    size_t bom = utf8_bom_length(data, len);
+    if (len - bom > SNIFF_CHARSET_BYTES) len = bom + SNIFF_CHARSET_BYTES;
+    prescan(data + bom, len - bom, bom != 0);
+    return bom;
+}
 
-        if (val)
-        {
-            if (val < 0x80)
-            {
-                *writer++ = (char)val;
-            }
-            else
-            {
-                char seq[4];
-                unsigned len = Xapian::Unicode::nonascii_to_utf8(val, seq);
-                std::copy(seq, seq + len, writer);
-                writer += len;
-            }
-        }
+void
+HtmlParser::feed(const char *data, size_t len)
+{
+    if (stopped) return;
+
+    if (!started) {
+	// Wait until there's enough to look for a charset declaration in.
+	pending.append(data, len);
+	if (pending.size() < SNIFF_CHARSET_BYTES) return;
+	pending.erase(0, start_document(pending.data(), pending.size()));
+	len = 0;
+    }
 
+    if (pending.empty()) {
+	// Parse straight from the caller's buffer, and only copy what's left.
+	size_t n = parse_chunk(data, data + len, false);
+	consumed += n;
+	pending.assign(data + n, len - n);
+    } else {
+	pending.append(data, len);
+	if (pending.size() < retry_size) return;
+	const char * p = pending.data();
+	size_t n = parse_chunk(p, p + pending.size(), false);
+	consumed += n;
+	pending.erase(0, n);
+    }
+    // Don't try an incomplete token again until the amount buffered has
+    // doubled, so a long token doesn't make parsing quadratic.
+    retry_size = pending.size() * 2;
+}
 
-        if (entity_end == s.end() || entity_end + 1 == s.end())
-            break;
+void
+HtmlParser::finish()
+{
+    if (!started)
+	pending.erase(0, start_document(pending.data(), pending.size()));
+    if (!stopped) {
+	const char * p = pending.data();
+	parse_chunk(p, p + pending.size(), true);
+    }
+    consumed += pending.size();
+    pending.resize(0);
+    retry_size = 0;
+}
 
-        std::advance(entity_end, 1);
+inline static bool
+is_text_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
 
-        begin = std::find(entity_end, s.end(), '&');
-        std::copy(entity_end, begin, writer);
-        writer += std::distance(entity_end, begin);
+void
+HtmlParser::emit_text(const char *p, const char *end, bool has_amp)
+{
+    converter.set_charset(charset);
+    if (converter.active()) {
+	text_buf.resize(0);
+	converter.convert(p, end - p, text_buf);
+	process_undecoded_text(text_buf, has_amp);
+    } else {
+	process_undecoded_text(StringView(p, end - p), has_amp);
     }
+}
+
+// Set encoding to that given by an XML declaration's pseudo-attributes (decl
+// is what follows "<?xml"), leaving it unchanged if none is given.
+static void
+get_xml_encoding(const string &decl, string &encoding)
+{
+    size_t enc = decl.find("encoding");
+    if (enc == string::npos) return;
+
+    enc = decl.find_first_not_of(" \t\r\n", enc + 8);
+    if (enc == string::npos || decl[enc] != '=') return;
+
+    enc = decl.find_first_not_of(" \t\r\n", enc + 1);
+    if (enc == string::npos) return;
+    if (decl[enc] != '"' && decl[enc] != '\'') return;
 
-    s.erase(writer, s.end());
+    char quote = decl[enc++];
+    size_t enc_end = decl.find(quote, enc);
+    if (enc_end == string::npos) return;
+
+    encoding = decl.substr(enc, enc_end - enc);
 }
 
+/* Return the start of the first occurrence of needle (len bytes) in [p, end),
+ * or end if there isn't one.
+ *
+ * Candidates are found by scanning for the last byte of needle, so this
+ * makes a single pass over [p, end), comparing at most len bytes at each
+ * candidate.
+ */
+static const char *
+find_string(const char *p, const char *end, const char *needle, size_t len)
+{
+    if (size_t(end - p) < len) return end;
+    const char * q = p + len - 1;
+    while (true) {
+	q = charscan(q, end, ScanBytes(needle[len - 1]));
+	if (q == end) return end;
+	if (memcmp(q - (len - 1), needle, len - 1) == 0) return q - (len - 1);
+	++q;
+    }
+}
 
-void
-HtmlParser::parse_html(const string &body)
+/* Find the close tag of a raw text element called name (len bytes) in
+ * [p, end): "</" and the name (ignoring case), followed by whitespace, '/',
+ * '>' or the end of the document.  Returns a pointer to its '<', or end if
+ * there isn't one.
+ *
+ * If final is false, more of the document follows, so a possible close tag
+ * right at the end which can't be checked yet isn't returned.
+ */
+static const char *
+find_close_tag(const char *p, const char *end, const char *name, size_t len,
+	       bool final)
 {
-    in_script = false;
+    while (true) {
+	p = charscan(p, end, ScanBytes('<'));
+	if (size_t(end - p) < len + 2) return end;
+	if (p[1] == '/' && strncasecmp(p + 2, name, len) == 0) {
+	    if (size_t(end - p) == len + 2) return final ? p : end;
+	    char ch = p[len + 2];
+	    if (ch == '>' || ch == '/' || (ch && strchr(" \t\n\r\f", ch)))
+		return p;
+	}
+	++p;
+    }
+}
 
-    map<string,string> Param;
-    string::const_iterator start = body.begin();
+size_t
+HtmlParser::parse_chunk(const char *begin, const char *end, bool final)
+{
+    // Where the document starts, if it's in this chunk.
+    const char * const doc_begin = consumed ? NULL : begin;
+    // Set once we know there's no --> in the rest of the chunk.
+    bool no_comment_end = false;
+    const char * start = begin;
 
     while (true) {
+    if (raw_text_id != TAG_UNKNOWN) {
+        // Skip to the element's close tag, which is then parsed as usual.
+        const char * name = html_tag_name(raw_text_id);
+        size_t len = html_tag_name_len(raw_text_id);
+        const char * close = find_close_tag(start, end, name, len, final);
+        if (close == end) {
+        if (final) break;
+        // Keep back anything which could be the start of the close tag.
+        if (size_t(end - start) > len + 2) start = end - (len + 2);
+        return start - begin;
+        }
+        raw_text_id = TAG_UNKNOWN;
+        start = close;
+    }
+
     // Skip through until we find an HTML tag, a comment, or the end of
     // document.  Ignore isolated occurences of `<' which don't start
-    // a tag or comment.
-    string::const_iterator p = start;
+    // a tag or comment.  Note whether the text contains any `&' as we go,
+    // so entity decoding can be skipped for text which doesn't.
+    const char * p = start;
+    bool text_has_amp = false;
+    // Set if we need to see more of the document to know where the text
+    // ends.
+    bool more = false;
     while (true) {
-        p = find(p, body.end(), '<');
-        if (p == body.end()) break;
-        unsigned char ch = *(p + 1);
+        p = charscan(p, end, ScanBytes('<', '&'));
+        if (p == end) {
+        more = !final;
+        break;
+        }
+        if (*p == '&') {
+        text_has_amp = true;
+        ++p;
+        continue;
+        }
+        if (p + 1 == end && !final) {
+        more = true;
+        break;
+        }
+        unsigned char ch = (p + 1 != end) ? *(p + 1) : 0;
 
         // Tag, closing tag, or comment (or SGML declaration).
         if ((!in_script && isalpha(ch)) || ch == '/' || ch == '!') break;
 
         if (ch == '?') {
         // PHP code or XML declaration.
-        // XML declaration is only valid at the start of the first line.
-        // FIXME: need to deal with BOMs...
-        if (p != body.begin() || body.size() < 20) break;
+        // XML declaration is only valid at the start of the first line
+        // (after any byte order mark, which start_document() skips).
+        if (p != doc_begin) break;
+        if (end - p < 20) {
+            if (!final) more = true;
+            break;
+        }
 
         // XML declaration looks something like this:
         // <?xml version="1.0" encoding="UTF-8"?>
         if (p[2] != 'x' || p[3] != 'm' || p[4] != 'l') break;
         if (strchr(" \t\r\n", p[5]) == NULL) break;
 
-        string::const_iterator decl_end = find(p + 6, body.end(), '?');
-        if (decl_end == body.end()) break;
+        const char * decl_end = charscan(p + 6, end, ScanBytes('?'));
+        if (decl_end == end) {
+            if (!final) more = true;
+            break;
+        }
 
         // Default charset for XML is UTF-8.
-        charset = "UTF-8";
-
-        string decl(p + 6, decl_end);
-        size_t enc = decl.find("encoding");
-        if (enc == string::npos) break;
-
-        enc = decl.find_first_not_of(" \t\r\n", enc + 8);
-        if (enc == string::npos || enc == decl.size()) break;
-
-        if (decl[enc] != '=') break;
-        
-        enc = decl.find_first_not_of(" \t\r\n", enc + 1);
-        if (enc == string::npos || enc == decl.size()) break;
-
-        if (decl[enc] != '"' && decl[enc] != '\'') break;
-
-        char quote = decl[enc++];
-        size_t enc_end = decl.find(quote, enc);
-
-        if (enc != string::npos)
-            charset = decl.substr(enc, enc_end - enc);
-
+        string xml_charset("UTF-8");
+        get_xml_encoding(string(p + 6, decl_end), xml_charset);
+        xml_declaration(xml_charset);
         break;
         }
         p++;
     }
 
+    if (more) {
+        // Process the text up to the last whitespace, which can't be part
+        // of a reference or a multibyte character, and keep the rest until
+        // we know where it ends.
+        const char * cut = p;
+        while (cut != start && !is_text_space(cut[-1])) --cut;
+        if (cut != start) emit_text(start, cut, text_has_amp);
+        return cut - begin;
+    }
 
     // Process text up to start of tag.
     if (p > start) {
-        string text = body.substr(start - body.begin(), p - start);
-        convert_to_utf8(text, charset);
-        decode_entities(text);
-        process_text(text);
+        emit_text(start, p, text_has_amp);
+        if (stopped) break;
     }
 
-    if (p == body.end()) break;
+    if (p == end) break;
+
+    // Where this tag (or comment, etc) starts, in case we need to come
+    // back to it when more of the document is available.
+    const char * token = p;
 
     start = p + 1;
 
-    if (start == body.end()) break;
+    if (start == end) break;
 
     if (*start == '!') {
-        if (++start == body.end()) break;
-        if (++start == body.end()) break;
+        if (++start == end || ++start == end) {
+        if (!final) return token - begin;
+        break;
+        }
         // comment or SGML declaration
         if (*(start - 1) == '-' && *start == '-') {
         ++start;
-        string::const_iterator close = find(start, body.end(), '>');
-        // An unterminated comment swallows rest of document
-        // (like Netscape, but unlike MSIE IIRC)
-        if (close == body.end()) break;
-
-        p = close;
-        // look for -->
-        while (p != body.end() && (*(p - 1) != '-' || *(p - 2) != '-'))
-            p = find(p + 1, body.end(), '>');
+        // Look for -->, whose dashes may be those of the <!--.  Once that
+        // has failed, it will fail for every later comment too.
+        const char * close = end;
+        if (!no_comment_end) {
+            close = find_string(start - 2, end, "-->", 3);
+            no_comment_end = (close == end);
+        }
 
-        if (p != body.end()) {
+        if (close != end) {
+            p = close + 2;
             // Check for htdig's "ignore this bit" comments.
-            if (p - start == 15 && string(start, p - 2) == "htdig_noindex") {
-            string::size_type i;
-            i = body.find("<!--/htdig_noindex-->", p + 1 - body.begin());
-            if (i == string::npos) break;
-            start = body.begin() + i + 21;
+            if (p - start == 15 && memcmp(start, "htdig_noindex", 13) == 0) {
+            static const char marker[] = "<!--/htdig_noindex-->";
+            const char * i = find_string(p + 1, end, marker, 21);
+            if (i == end) {
+                if (!final) return token - begin;
+                break;
+            }
+            start = i + 21;
             continue;
             }
             // If we found --> skip to there.
             start = p;
         } else {
-            // Otherwise skip to the first > we found (as Netscape does).
-            start = close;
+            if (!final) return token - begin;
+            // Otherwise skip to the first > (as Netscape does), or if
+            // there isn't one, swallow the rest of the document (unlike
+            // MSIE IIRC).
+            start = charscan(start, end, ScanBytes('>'));
+            if (start == end) break;
         }
         } else {
         // just an SGML declaration, perhaps giving the DTD - ignore it
-        start = find(start - 1, body.end(), '>');
-        if (start == body.end()) break;
+        start = charscan(start - 1, end, ScanBytes('>'));
+        if (start == end) {
+            if (!final) return token - begin;
+            break;
+        }
         }
         ++start;
     } else if (*start == '?') {
-        if (++start == body.end()) break;
+        if (++start == end) {
+        if (!final) return token - begin;
+        break;
+        }
         // PHP - swallow until ?> or EOF
-        start = find(start + 1, body.end(), '>');
-
-        // look for ?>
-        while (start != body.end() && *(start - 1) != '?')
-        start = find(start + 1, body.end(), '>');
+        const char * close = find_string(start, end, "?>", 2);
 
         // unterminated PHP swallows rest of document (rather arbitrarily
         // but it avoids polluting the database when things go wrong)
-        if (start != body.end()) ++start;
+        if (close == end && !final) return token - begin;
+        start = (close == end) ? end : close + 2;
     } else {
         // opening or closing tag
         int closing = 0;
 
         if (*start == '/') {
         closing = 1;
-        start = find_if(start + 1, body.end(), p_notwhitespace);
+        start = find_if(start + 1, end, p_notwhitespace);
         }
 
         p = start;
-        start = find_if(start, body.end(), p_nottag);
-        string tag = body.substr(p - body.begin(), start - p);
-        // convert tagname to lowercase
-        for (string::iterator i = tag.begin(); i != tag.end(); ++i)
-        *i = tolower(static_cast<unsigned char>(*i));
+        start = find_if(start, end, p_nottag);
 
         if (closing) {
-        closing_tag(tag);
-        if (in_script && tag == "script") in_script = false;
-
         /* ignore any bogus parameters on closing tags */
-        p = find(start, body.end(), '>');
-        if (p == body.end()) break;
-        start = p + 1;
+        const char * close = charscan(start, end, ScanBytes('>'));
+        if (close == end && !final) return token - begin;
+
+        StringView tag = lowercase_tag(p, start);
+        HtmlTagId id = html_tag_lookup(tag.data(), tag.size());
+        if (!closing_tag_view(tag, id)) {
+        stopped = true;
+        return end - begin;
+        }
+        if (in_script && id == TAG_SCRIPT) in_script = false;
+
+        if (close == end) break;
+        start = close + 1;
         } else {
-        while (start < body.end() && *start != '>') {
-            string name, value;
+        const char * name_end = start;
+        attrs.clear();
+        while (start < end && *start != '>') {
+            const char * name = start;
 
-            p = find_if(start, body.end(), p_whitespaceeqgt);
+            p = charscan(start, end, ScanSpaceOr('=', '>'));
 
-            name = body.substr(start - body.begin(), p - start);
+            size_t name_len = p - start;
 
-            p = find_if(p, body.end(), p_notwhitespace);
+            p = find_if(p, end, p_notwhitespace);
 
             start = p;
-            if (start != body.end() && *start == '=') {
+            if (start != end && *start == '=') {
             int quote;
+            StringView value;
 
-            start = find_if(start + 1, body.end(), p_notwhitespace);
+            start = find_if(start + 1, end, p_notwhitespace);
 
-            p = body.end();
+            p = end;
 
-            quote = *start;
+            quote = (start != end) ? *start : 0;
             if (quote == '"' || quote == '\'') {
                 start++;
-                p = find(start, body.end(), quote);
+                p = charscan(start, end, ScanBytes(char(quote)));
+                // Whether a value is treated as quoted depends on there
+                // being a closing quote anywhere in the rest of the
+                // document.
+                if (p == end && !final) return token - begin;
             }
 
-            if (p == body.end()) {
+            if (p == end) {
                 // unquoted or no closing quote
-                p = find_if(start, body.end(), p_whitespacegt);
+                p = charscan(start, end, ScanSpaceOr('>'));
 
-                value = body.substr(start - body.begin(), p - start);
+                value = StringView(start, p - start);
 
-                start = find_if(p, body.end(), p_notwhitespace);
+                start = find_if(p, end, p_notwhitespace);
             } else {
-                value = body.substr(start - body.begin(), p - start);
+                value = StringView(start, p - start);
             }
 
-            if (name.size()) {
-                // convert parameter name to lowercase
-                string::iterator i;
-                for (i = name.begin(); i != name.end(); ++i)
-                *i = tolower(static_cast<unsigned char>(*i));
-                // in case of multiple entries, use the first
-                // (as Netscape does)
-                if (Param.find(name) == Param.end())
-                Param[name] = value;
-            }
+            if (name_len) attrs.add(name, name_len, value);
             }
         }
-        opening_tag(tag, Param);
-        Param.clear();
+        if (start == end && !final) return token - begin;
+
+        StringView tag = lowercase_tag(token + 1, name_end);
+        HtmlTagId id = html_tag_lookup(tag.data(), tag.size());
+        if (!opening_tag_view(tag, id, attrs)) {
+        stopped = true;
+        return end - begin;
+        }
 
         // In <script> tags we ignore opening tags to avoid problems
         // with "a<b".
-        if (tag == "script") in_script = true;
+        if (id == TAG_SCRIPT) in_script = true;
+        if (id != TAG_UNKNOWN && skip_content(id)) raw_text_id = id;
 
-        if (start != body.end() && *start == '>') ++start;
+        if (start != end && *start == '>') ++start;
         }
     }
     }
+    return end - begin;
 }
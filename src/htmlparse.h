@@ -24,23 +24,213 @@
 
 #include <string>
 #include <map>
+#include <vector>
+
+#include "htmltags.h"
+#include "stringview.h"
+#include "utf8convert.h"
 
 using std::string;
 using std::map;
 
+/** The attributes of an opening tag.
+ *
+ *  Names are lowercased, and values refer directly into the document.  If
+ *  an attribute is given more than once, the first value is used (as
+ *  Netscape does).  Tags rarely have more than a handful of attributes, so
+ *  lookup is a linear search.  The parser reuses a single instance for the
+ *  whole parse, so once it has grown to fit, adding and looking up
+ *  attributes doesn't allocate.
+ */
+class HtmlAttributes {
+    struct Attr {
+	size_t name_start, name_len;
+	StringView value;
+	Attr(size_t start, size_t len, const StringView &value_)
+	    : name_start(start), name_len(len), value(value_) { }
+    };
+
+    std::vector<Attr> attrs;
+
+    // The lowercased names, end to end.
+    string names;
+
+  public:
+    /// Remove all attributes, keeping the allocated space.
+    void clear() { attrs.clear(); names.resize(0); }
+
+    /** Add an attribute, lowercasing its name.
+     *
+     *  Returns false (and leaves the attributes unchanged) if there's
+     *  already an attribute with that name.
+     */
+    bool add(const char *name, size_t len, const StringView &value);
+
+    /** Find the value of an attribute.
+     *
+     *  @param name	The name to look for, which must be lowercase.
+     *
+     *  Returns NULL if the attribute isn't present.  The pointer is valid
+     *  until the attributes are next modified.
+     */
+    const StringView * find(const StringView &name) const;
+
+    size_t size() const { return attrs.size(); }
+    bool empty() const { return attrs.empty(); }
+
+    StringView name(size_t i) const {
+	return StringView(names.data() + attrs[i].name_start, attrs[i].name_len);
+    }
+    const StringView & value(size_t i) const { return attrs[i].value; }
+};
+
 class HtmlParser {
     protected:
 	void decode_entities(string &s);
+
+	/** Append text to out, decoding references if decode is true and
+	 *  collapsing each run of spaces, tabs, and newlines (including any
+	 *  from references) to a single space.  If unicode_spaces is true,
+	 *  U+00A0 and the other Unicode space separators are collapsed too.
+	 *
+	 *  A space is only written before following text, and never at the
+	 *  start of out: pending_space records whether one is owed.
+	 */
+	static void append_collapsed(string &out, const StringView &text,
+				     bool decode, bool &pending_space,
+				     bool unicode_spaces);
 	bool in_script;
 	string charset;
-	static map<string, unsigned int> named_ents;
+
+	// Set once a callback has asked for parsing to stop, so the rest of
+	// the document is ignored.  Tag callbacks ask by returning false; text
+	// callbacks can set this directly.
+	bool stopped;
+    private:
+	// Scratch space reused for text which needs converting or decoding,
+	// and for tag names which need lowercasing.
+	string text_buf;
+	string tag_buf;
+	StringView lowercase_tag(const char *p, const char *end);
+
+	// Attributes of the current opening tag.
+	HtmlAttributes attrs;
+
+	// Input passed to feed() which hasn't been parsed yet, the number of
+	// bytes of the document before it, and how big it must get before we
+	// try parsing it again.
+	string pending;
+	size_t consumed;
+	size_t retry_size;
+
+	// False until start_document() has been called for this document.
+	bool started;
+
+	// Skip any byte order mark and choose the character set, returning
+	// the length of the byte order mark.
+	size_t start_document(const char *data, size_t len);
+
+	// If not TAG_UNKNOWN, we're in an element whose content skip_content()
+	// said to skip.
+	HtmlTagId raw_text_id;
+
+	// Converts text from charset, keeping any iconv descriptors open for
+	// the life of the parser.
+	Utf8Converter converter;
+
+	void emit_text(const char *p, const char *end, bool has_amp);
+    protected:
+	/** Parse as much of [begin, end) as possible.
+	 *
+	 *  If final is false, more of the document follows, so stop before
+	 *  anything whose meaning could depend on what comes next.  Returns
+	 *  the number of bytes parsed.
+	 */
+	size_t parse_chunk(const char *begin, const char *end, bool final);
+
+	/** Called with the start of a document before parsing it.
+	 *
+	 *  p and len give up to SNIFF_CHARSET_BYTES of the document, after any
+	 *  UTF-8 byte order mark, and bom is true if there was one.  Subclasses
+	 *  can override this to choose the character set; by default it does
+	 *  nothing.
+	 */
+	virtual void prescan(const char * /*p*/, size_t /*len*/, bool /*bom*/) { }
+
+	/** Called with the character set given by an XML declaration at the
+	 *  start of the document ("UTF-8" if it doesn't give one).  By default
+	 *  this sets charset.
+	 */
+	virtual void xml_declaration(const string &charset_) {
+	    charset = charset_;
+	}
+
+	/** Return true to skip the content of elements with this id.
+	 *
+	 *  The content is passed over up to the next matching close tag (in
+	 *  any case) without being parsed, converted, or passed to any of the
+	 *  callbacks; the opening and close tags are reported as usual.  By
+	 *  default nothing is skipped.
+	 */
+	virtual bool skip_content(HtmlTagId /*id*/) const { return false; }
     public:
 	virtual void process_text(const string &/*text*/) { }
-	virtual void opening_tag(const string &/*tag*/,
-				 const map<string,string> &/*p*/) { }
-	virtual void closing_tag(const string &/*tag*/) { }
+	// The tag callbacks return false to stop parsing the document.
+	virtual bool opening_tag(const string &/*tag*/,
+				 const map<string,string> &/*p*/) {
+	    return true;
+	}
+	virtual bool closing_tag(const string &/*tag*/) { return true; }
+
+	// Zero-copy versions of the callbacks above.  The views refer to the
+	// document being parsed (or to scratch space) and are only valid
+	// during the call.  Tag names are also passed as an HtmlTagId, which
+	// is TAG_UNKNOWN for names which aren't HTML elements.  By default
+	// these copy and call the methods above, so subclasses may override
+	// whichever set suits them.
+	virtual void process_text_view(const StringView &text) {
+	    process_text(text.str());
+	}
+	// Called with each run of text before references in it are decoded
+	// (has_amp is false if it contains no '&', so needs no decoding).
+	// By default this decodes it and calls process_text_view().
+	virtual void process_undecoded_text(const StringView &text,
+					    bool has_amp);
+	virtual bool opening_tag_view(const StringView &tag, HtmlTagId id,
+				      const HtmlAttributes &attrs);
+	virtual bool closing_tag_view(const StringView &tag, HtmlTagId /*id*/) {
+	    return closing_tag(tag.str());
+	}
 	virtual void parse_html(const string &text);
-	HtmlParser();
+
+	/// The character set the document is being decoded from.
+	const string & get_charset() const { return charset; }
+
+	/// Parse a document held in a buffer, without copying it.
+	void parse_html(const char *data, size_t len);
+
+	/** Parse the next part of a document, for when it arrives in pieces.
+	 *
+	 *  Tags, comments, references and characters may be split between
+	 *  calls, and the results are the same as passing the whole document
+	 *  to parse_html().  Any incomplete part at the end is copied, so the
+	 *  data needn't outlive the call.
+	 */
+	virtual void feed(const char *data, size_t len);
+
+	/// Parse what remains after the last call to feed().
+	virtual void finish();
+
+	/** Forget any document parsed so far, ready to start another.
+	 *
+	 *  parse_html() does this itself, but call it between documents
+	 *  passed to feed().  Memory already allocated is kept for reuse.
+	 */
+	virtual void reset();
+
+	HtmlParser()
+	    : in_script(false), stopped(false), consumed(0), retry_size(0),
+	      started(false), raw_text_id(TAG_UNKNOWN) { }
 	virtual ~HtmlParser() { }
 };
 
@@ -0,0 +1,237 @@
+/* htmlparsebench.cc: measure MyHtmlParser throughput
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+/* Build with something like:
+ *
+ *   g++ -O2 -Isrc -o htmlparsebench src/htmlparsebench.cc src/charsettables.cc \
+ *       src/htmlparse.cc src/htmltags.cc src/mappedfile.cc src/myhtmlparse.cc \
+ *       src/namedentities.cc src/sniffcharset.cc src/utf8check.cc \
+ *       src/utf8convert.cc src/utf8itor.cc
+ *
+ * With no arguments a set of synthetic pages is parsed; otherwise each
+ * argument is read as an HTML file and parsed.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "myhtmlparse.h"
+
+using namespace std;
+
+// Aim to spend about this long (in seconds) parsing each input.
+static const double TARGET_SECONDS = 1.0;
+
+static double
+now()
+{
+    return double(clock()) / CLOCKS_PER_SEC;
+}
+
+static string
+make_text_page()
+{
+    // Long runs of text with few tags, like an article or a log dump.
+    string s = "<html><head><title>Text</title></head><body>\n";
+    for (int i = 0; i < 20000; ++i) {
+	s += "<p>The quick brown fox jumps over the lazy dog, and then it "
+	     "runs off into the forest where nobody can find it again; "
+	     "meanwhile the dog carries on sleeping in the sun.\n";
+    }
+    s += "</body></html>\n";
+    return s;
+}
+
+static string
+make_latin1_page()
+{
+    // Western European text in a single-byte character set.
+    string s = "<html><head><meta http-equiv=\"Content-Type\" "
+	       "content=\"text/html; charset=iso-8859-1\">"
+	       "<title>Latin-1</title></head><body>\n";
+    for (int i = 0; i < 20000; ++i) {
+	s += "<p>Le c\xe9l\xe8" "bre na\xefvet\xe9 du gar\xe7on \x93r\xeaveur\x94 "
+	     "co\xfbte cher \x96 \xe0 peu pr\xe8s \x80 100, \xe9" "crit-il.\n";
+    }
+    s += "</body></html>\n";
+    return s;
+}
+
+static string
+make_tag_page()
+{
+    // Deeply marked-up navigation, like a forum or a menu.
+    string s = "<html><head><title>Tags</title></head><body>\n";
+    for (int i = 0; i < 20000; ++i) {
+	s += "<div class=\"item\"><span id=s><a href=\"/x/y?z=1&amp;w=2\">"
+	     "link</a></span> <b>x</b><i>y</i><br></div>\n";
+    }
+    s += "</body></html>\n";
+    return s;
+}
+
+static string
+make_nested_page()
+{
+    // Links deep inside nested markup, like a mega-menu or a forum thread.
+    string s = "<html><head><title>Nested</title></head><body>\n";
+    for (int i = 0; i < 200; ++i) s += "<div class=\"level\"><ul>";
+    for (int i = 0; i < 10000; ++i) {
+	s += "<li><a href=\"/x/y?z=1\">link</a></li>\n";
+    }
+    s += "</body></html>\n";
+    return s;
+}
+
+static string
+make_attr_page()
+{
+    // Large inline attributes, as produced by style= and data: URIs.
+    string data(4000, 'A');
+    string s = "<html><head><title>Attrs</title></head><body>\n";
+    for (int i = 0; i < 1000; ++i) {
+	s += "<img alt='picture' src=\"data:image/png;base64,";
+	s += data;
+	s += "\"><span style=\"color: red; background: white; margin: 0\">"
+	     "caption &amp; credit</span>\n";
+    }
+    s += "</body></html>\n";
+    return s;
+}
+
+static string
+make_script_page()
+{
+    // Large inline scripts and stylesheets, full of '<' and markup-like
+    // strings, as in a typical bundled web app.
+    string s = "<html><head><title>Script</title><style>\n";
+    for (int i = 0; i < 5000; ++i) {
+	s += "div.c > p:after { content: \"<b>&amp;</b>\"; color: #333 }\n";
+    }
+    s += "</style><script>\n";
+    for (int i = 0; i < 20000; ++i) {
+	s += "for (i = 0; i < n && a[i] <= b; ++i) "
+	     "html += '<p class=\"x\">' + esc(t) + '</p><!-- -->';\n";
+    }
+    s += "</script></head><body><p>Hello.</body></html>\n";
+    return s;
+}
+
+static string
+make_short_page()
+{
+    // A small page which ends with </body>, followed by the sort of
+    // trailing junk which parsing stops before.
+    return "<html><head><title>Short</title></head><body>\n"
+	   "<p>Just a <a href=\"/x\">few</a> words.\n"
+	   "</body>\n<script>track();</script></html>\n";
+}
+
+static string
+repeat(const char * s, int n)
+{
+    string r;
+    while (n--) r += s;
+    return r;
+}
+
+static double
+time_runs(const string & html, int runs, bool metadata_only)
+{
+    // Reuse the parser and its memory between runs, as a crawler would.
+    MyHtmlParser p;
+    p.metadata_only = metadata_only;
+    double t = now();
+    for (int i = 0; i < runs; ++i) {
+	p.parse_html(html);
+    }
+    return now() - t;
+}
+
+static void
+bench(const string & name, const string & html, bool metadata_only = false)
+{
+    // Find how many runs take a measurable time, and scale that up.
+    int runs = 1;
+    double t = time_runs(html, runs, metadata_only);
+    while (t < TARGET_SECONDS / 20 && runs < 1000000) {
+	runs *= 2;
+	t = time_runs(html, runs, metadata_only);
+    }
+    if (t > 0) runs = int(runs * (TARGET_SECONDS / t)) + 1;
+
+    t = time_runs(html, runs, metadata_only);
+    double mb = double(html.size()) * runs / (1024.0 * 1024.0);
+    printf("%-24s %9lu bytes %7d runs %9.1f MB/s %10.2f us/doc\n",
+	   name.c_str(), (unsigned long)html.size(), runs,
+	   t > 0 ? mb / t : 0.0, t * 1e6 / runs);
+}
+
+int
+main(int argc, char ** argv)
+{
+    if (argc > 1) {
+	for (int i = 1; i < argc; ++i) {
+	    ifstream in(argv[i], ios::in | ios::binary);
+	    if (!in) {
+		cerr << "Couldn't read " << argv[i] << endl;
+		exit(1);
+	    }
+	    ostringstream buf;
+	    buf << in.rdbuf();
+	    bench(argv[i], buf.str());
+	}
+	return 0;
+    }
+
+    bench("text", make_text_page());
+    bench("latin1", make_latin1_page());
+    bench("tags", make_tag_page());
+    bench("nested", make_nested_page());
+    bench("attrs", make_attr_page());
+    bench("script", make_script_page());
+    // Almost all of this page is in its head, so metadata-only parsing
+    // still has to get through most of it.
+    bench("script (metadata)", make_script_page(), true);
+    bench("short", make_short_page());
+
+    // Hostile inputs, each at two sizes: if parsing is linear, the
+    // throughput should be about the same for both.
+    for (int n = 10000; n <= 40000; n *= 4) {
+	char suffix[32];
+	sprintf(suffix, " x%d", n);
+	bench(string("unclosed comments") + suffix, repeat("<!-- x> ", n));
+	bench(string("> in comment") + suffix,
+	      "<!--" + repeat("a> ", n) + "-->");
+	bench(string("php") + suffix, repeat("<? a> ", n));
+	bench(string("htdig_noindex") + suffix,
+	      repeat("<!--htdig_noindex--> > ", n));
+	bench(string("unclosed divs") + suffix, repeat("<div>", n));
+	bench(string("stray close tags") + suffix,
+	      repeat("<div>", 1000) + repeat("</span>", n));
+	bench(string("unclosed paragraphs") + suffix, repeat("<p>x", n));
+	bench(string("unclosed links") + suffix, repeat("<a href=x>", n));
+    }
+}
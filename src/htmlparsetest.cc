@@ -21,6 +21,7 @@
 #include <config.h>
 
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -50,17 +51,76 @@ static const testcase tests[] = {
     { 0, 0, 0, 0, 0 }
 };
 
+// Documents to parse in small pieces, checking the results are the same as
+// parsing each in one go, and the text of the first link in each.
+struct chunked_testcase {
+    const char * html;
+    const char * link_text;
+};
+
+static const chunked_testcase chunked_tests[] = {
+    { "<html><head><title>foo &amp; bar</title></head><body><p>Hello <a href=\"x\">"
+      "link</a> &#x263a; <!-- a comment --> world</p><p>second</body>", "link" },
+    // A link open across <body> or </title> only keeps the text after it.
+    { "<title>a</title><p>some text <a href=\"x\">link <body>body text</a> more",
+      "body text" },
+    { "<a href=\"x\">start<title>t</title>end</a> tail", "end" },
+    { "<script>if (a<b) a = b;</script><p>x &lt; y<br>z <a href=y>w</a></p>"
+      "<?php echo 1; ?>done", "w" },
+    { 0, 0 }
+};
+
+static bool
+same_results(const MyHtmlParser &a, const MyHtmlParser &b)
+{
+    if (a.dump != b.dump || a.title != b.title || a.keywords != b.keywords ||
+	a.parastarts != b.parastarts || a.links.size() != b.links.size())
+	return false;
+    for (size_t i = 0; i != a.links.size(); ++i) {
+	HtmlLink x = a.links[i], y = b.links[i];
+	if (x.target() != y.target() || x.text() != y.text() ||
+	    x.para() != y.para() || x.start_pos() != y.start_pos())
+	    return false;
+    }
+    return true;
+}
+
+static void
+check_chunked()
+{
+    for (size_t i = 0; chunked_tests[i].html; ++i) {
+	string html = chunked_tests[i].html;
+	MyHtmlParser whole;
+	whole.parse_html(html);
+	if (whole.links.empty() ||
+	    whole.links[0].text() != StringView(chunked_tests[i].link_text)) {
+	    cout << "LINK TEXT " << i << ": ["
+		 << (whole.links.empty() ? "" : whole.links[0].text().str())
+		 << "] != [" << chunked_tests[i].link_text << "]" << endl;
+	    exit(1);
+	}
+	for (size_t chunk = 1; chunk <= 7; ++chunk) {
+	    MyHtmlParser p;
+	    for (size_t j = 0; j < html.size(); j += chunk) {
+		p.feed(html.data() + j, min(chunk, html.size() - j));
+	    }
+	    p.finish();
+	    if (!same_results(whole, p)) {
+		cout << "CHUNKED " << i << " (" << chunk << " bytes): [" << p.dump
+		     << "] != [" << whole.dump << "]" << endl;
+		exit(1);
+	    }
+	}
+    }
+}
+
 int
 main()
 {
+    check_chunked();
     for (size_t i = 0; tests[i].html; ++i) {
 	MyHtmlParser p;
-	try {
-	    p.parse_html(tests[i].html);
-	} catch (bool) {
-	    // MyHtmlParser throws a bool to abandon parsing at </body> or when
-	    // indexing is disallowed
-	}
+	p.parse_html(tests[i].html);
 	if (!p.indexing_allowed) {
 	    cout << "indexing disallowed by meta tag - skipping\n";
 	    continue;
@@ -0,0 +1,258 @@
+/* htmltags.cc: ids for HTML element names.
+ *
+ * This file is automatically generated by configutils/genhtmltags.py
+ */
+
+#include <config.h>
+
+#include "htmltags.h"
+
+#include <string.h>
+
+#include "perfecthash.h"
+
+static const char * const tag_names[TAG_COUNT] = {
+    "",
+    "a",
+    "abbr",
+    "acronym",
+    "address",
+    "applet",
+    "area",
+    "article",
+    "aside",
+    "audio",
+    "b",
+    "base",
+    "basefont",
+    "bdi",
+    "bdo",
+    "bgsound",
+    "big",
+    "blink",
+    "blockquote",
+    "body",
+    "br",
+    "button",
+    "canvas",
+    "caption",
+    "center",
+    "cite",
+    "code",
+    "col",
+    "colgroup",
+    "data",
+    "datalist",
+    "dd",
+    "del",
+    "details",
+    "dfn",
+    "dialog",
+    "dir",
+    "div",
+    "dl",
+    "dt",
+    "em",
+    "embed",
+    "fieldset",
+    "figcaption",
+    "figure",
+    "font",
+    "footer",
+    "form",
+    "frame",
+    "frameset",
+    "h1",
+    "h2",
+    "h3",
+    "h4",
+    "h5",
+    "h6",
+    "head",
+    "header",
+    "hgroup",
+    "hr",
+    "html",
+    "i",
+    "iframe",
+    "image",
+    "img",
+    "input",
+    "ins",
+    "isindex",
+    "kbd",
+    "keygen",
+    "label",
+    "legend",
+    "li",
+    "link",
+    "listing",
+    "main",
+    "map",
+    "mark",
+    "marquee",
+    "math",
+    "menu",
+    "menuitem",
+    "meta",
+    "meter",
+    "multicol",
+    "nav",
+    "nextid",
+    "nobr",
+    "noembed",
+    "noframes",
+    "noscript",
+    "object",
+    "ol",
+    "optgroup",
+    "option",
+    "output",
+    "p",
+    "param",
+    "picture",
+    "plaintext",
+    "pre",
+    "progress",
+    "q",
+    "rb",
+    "rp",
+    "rt",
+    "rtc",
+    "ruby",
+    "s",
+    "samp",
+    "script",
+    "search",
+    "section",
+    "select",
+    "slot",
+    "small",
+    "source",
+    "spacer",
+    "span",
+    "strike",
+    "strong",
+    "style",
+    "sub",
+    "summary",
+    "sup",
+    "svg",
+    "table",
+    "tbody",
+    "td",
+    "template",
+    "textarea",
+    "tfoot",
+    "th",
+    "thead",
+    "time",
+    "title",
+    "tr",
+    "track",
+    "tt",
+    "u",
+    "ul",
+    "var",
+    "video",
+    "wbr",
+    "xmp",
+};
+
+static const unsigned char tag_name_lens[TAG_COUNT] = {
+    0,
+    1, 4, 7, 7, 6, 4, 7, 5, 5, 1, 4, 8,
+    3, 3, 7, 3, 5, 10, 4, 2, 6, 6, 7, 6,
+    4, 4, 3, 8, 4, 8, 2, 3, 7, 3, 6, 3,
+    3, 2, 2, 2, 5, 8, 10, 6, 4, 6, 4, 5,
+    8, 2, 2, 2, 2, 2, 2, 4, 6, 6, 2, 4,
+    1, 6, 5, 3, 5, 3, 7, 3, 6, 5, 6, 2,
+    4, 7, 4, 3, 4, 7, 4, 4, 8, 4, 5, 8,
+    3, 6, 4, 7, 8, 8, 6, 2, 8, 6, 6, 1,
+    5, 7, 9, 3, 8, 1, 2, 2, 2, 3, 4, 1,
+    4, 6, 6, 7, 6, 4, 5, 6, 6, 4, 6, 6,
+    5, 3, 7, 3, 3, 5, 5, 2, 8, 8, 5, 2,
+    5, 4, 5, 2, 5, 2, 1, 2, 3, 5, 3, 3,
+};
+
+#define TAG_BUCKETS 72
+#define TAG_SLOTS 512
+
+static const unsigned short tag_displacements[TAG_BUCKETS] = {
+    1, 1, 1, 0, 2, 1, 0, 2, 1, 1, 1, 1,
+    3, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 2, 1, 1, 1, 2, 1, 0, 1, 4, 0,
+    1, 2, 1, 0, 1, 1, 1, 1, 1, 3, 3, 2,
+    2, 1, 1, 1, 3, 2, 1, 1, 1, 3, 1, 3,
+    1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1,
+};
+
+// The id of the tag stored in each slot, or TAG_UNKNOWN.
+static const unsigned char tag_slots[TAG_SLOTS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+    29, 0, 0, 18, 0, 0, 33, 0, 0, 0, 115, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 119, 0,
+    0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 110, 0, 0, 105, 0, 0, 0, 136, 99,
+    65, 0, 17, 0, 123, 0, 0, 42, 0, 63, 10, 0,
+    0, 137, 0, 0, 0, 0, 0, 0, 96, 51, 130, 0,
+    20, 0, 0, 0, 38, 0, 0, 92, 0, 0, 0, 0,
+    0, 0, 0, 101, 0, 40, 0, 91, 30, 0, 0, 0,
+    0, 143, 0, 0, 0, 77, 0, 46, 0, 116, 0, 0,
+    0, 0, 75, 0, 0, 0, 0, 64, 0, 69, 0, 0,
+    144, 26, 0, 0, 0, 0, 3, 14, 114, 0, 142, 36,
+    128, 0, 0, 0, 0, 89, 0, 0, 0, 71, 0, 15,
+    0, 28, 0, 0, 93, 0, 0, 50, 0, 11, 0, 0,
+    0, 0, 56, 0, 0, 0, 0, 0, 118, 0, 0, 70,
+    0, 0, 0, 0, 88, 0, 0, 0, 0, 121, 95, 0,
+    7, 0, 0, 0, 53, 0, 0, 0, 35, 6, 0, 2,
+    66, 0, 0, 86, 81, 140, 9, 0, 19, 0, 47, 0,
+    0, 97, 0, 37, 132, 74, 76, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 98, 0, 0, 126, 0, 0,
+    39, 0, 0, 0, 0, 82, 0, 0, 107, 0, 0, 0,
+    0, 41, 0, 0, 0, 54, 0, 0, 0, 45, 0, 0,
+    27, 0, 0, 0, 0, 0, 125, 0, 12, 0, 0, 0,
+    0, 124, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 60, 133, 0, 0, 84, 108, 0,
+    0, 0, 0, 0, 62, 0, 0, 0, 0, 57, 79, 0,
+    44, 134, 0, 49, 0, 32, 127, 0, 0, 104, 0, 0,
+    120, 68, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0,
+    0, 0, 0, 24, 138, 0, 0, 0, 0, 13, 135, 0,
+    73, 0, 0, 0, 117, 0, 0, 80, 0, 0, 0, 0,
+    0, 85, 59, 0, 90, 141, 0, 0, 0, 0, 0, 0,
+    0, 0, 129, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+    0, 0, 0, 0, 0, 100, 0, 0, 103, 48, 0, 139,
+    58, 0, 0, 0, 5, 0, 0, 0, 0, 94, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 0, 72, 0, 0, 0, 0,
+    0, 0, 0, 0, 31, 0, 0, 25, 0, 0, 0, 0,
+    131, 52, 0, 0, 111, 0, 0, 0, 78, 0, 0, 0,
+    0, 0, 0, 0, 4, 1, 122, 113, 43, 109, 0, 0,
+    0, 0, 0, 102, 22, 0, 0, 106, 0, 0, 55, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+HtmlTagId
+html_tag_lookup(const char *p, size_t len)
+{
+    unsigned d = tag_displacements[perfect_hash(0, p, len) % TAG_BUCKETS];
+    unsigned id = tag_slots[perfect_hash(d, p, len) & (TAG_SLOTS - 1)];
+    if (id == TAG_UNKNOWN || tag_name_lens[id] != len ||
+	memcmp(tag_names[id], p, len) != 0)
+	return TAG_UNKNOWN;
+    return HtmlTagId(id);
+}
+
+const char *
+html_tag_name(HtmlTagId id)
+{
+    return tag_names[id];
+}
+
+size_t
+html_tag_name_len(HtmlTagId id)
+{
+    return tag_name_lens[id];
+}
@@ -0,0 +1,172 @@
+/* htmltags.h: ids for HTML element names.
+ *
+ * This file is automatically generated by configutils/genhtmltags.py
+ */
+
+#ifndef OMEGA_INCLUDED_HTMLTAGS_H
+#define OMEGA_INCLUDED_HTMLTAGS_H
+
+#include <stddef.h>
+
+enum HtmlTagId {
+    TAG_UNKNOWN = 0,
+    TAG_A,
+    TAG_ABBR,
+    TAG_ACRONYM,
+    TAG_ADDRESS,
+    TAG_APPLET,
+    TAG_AREA,
+    TAG_ARTICLE,
+    TAG_ASIDE,
+    TAG_AUDIO,
+    TAG_B,
+    TAG_BASE,
+    TAG_BASEFONT,
+    TAG_BDI,
+    TAG_BDO,
+    TAG_BGSOUND,
+    TAG_BIG,
+    TAG_BLINK,
+    TAG_BLOCKQUOTE,
+    TAG_BODY,
+    TAG_BR,
+    TAG_BUTTON,
+    TAG_CANVAS,
+    TAG_CAPTION,
+    TAG_CENTER,
+    TAG_CITE,
+    TAG_CODE,
+    TAG_COL,
+    TAG_COLGROUP,
+    TAG_DATA,
+    TAG_DATALIST,
+    TAG_DD,
+    TAG_DEL,
+    TAG_DETAILS,
+    TAG_DFN,
+    TAG_DIALOG,
+    TAG_DIR,
+    TAG_DIV,
+    TAG_DL,
+    TAG_DT,
+    TAG_EM,
+    TAG_EMBED,
+    TAG_FIELDSET,
+    TAG_FIGCAPTION,
+    TAG_FIGURE,
+    TAG_FONT,
+    TAG_FOOTER,
+    TAG_FORM,
+    TAG_FRAME,
+    TAG_FRAMESET,
+    TAG_H1,
+    TAG_H2,
+    TAG_H3,
+    TAG_H4,
+    TAG_H5,
+    TAG_H6,
+    TAG_HEAD,
+    TAG_HEADER,
+    TAG_HGROUP,
+    TAG_HR,
+    TAG_HTML,
+    TAG_I,
+    TAG_IFRAME,
+    TAG_IMAGE,
+    TAG_IMG,
+    TAG_INPUT,
+    TAG_INS,
+    TAG_ISINDEX,
+    TAG_KBD,
+    TAG_KEYGEN,
+    TAG_LABEL,
+    TAG_LEGEND,
+    TAG_LI,
+    TAG_LINK,
+    TAG_LISTING,
+    TAG_MAIN,
+    TAG_MAP,
+    TAG_MARK,
+    TAG_MARQUEE,
+    TAG_MATH,
+    TAG_MENU,
+    TAG_MENUITEM,
+    TAG_META,
+    TAG_METER,
+    TAG_MULTICOL,
+    TAG_NAV,
+    TAG_NEXTID,
+    TAG_NOBR,
+    TAG_NOEMBED,
+    TAG_NOFRAMES,
+    TAG_NOSCRIPT,
+    TAG_OBJECT,
+    TAG_OL,
+    TAG_OPTGROUP,
+    TAG_OPTION,
+    TAG_OUTPUT,
+    TAG_P,
+    TAG_PARAM,
+    TAG_PICTURE,
+    TAG_PLAINTEXT,
+    TAG_PRE,
+    TAG_PROGRESS,
+    TAG_Q,
+    TAG_RB,
+    TAG_RP,
+    TAG_RT,
+    TAG_RTC,
+    TAG_RUBY,
+    TAG_S,
+    TAG_SAMP,
+    TAG_SCRIPT,
+    TAG_SEARCH,
+    TAG_SECTION,
+    TAG_SELECT,
+    TAG_SLOT,
+    TAG_SMALL,
+    TAG_SOURCE,
+    TAG_SPACER,
+    TAG_SPAN,
+    TAG_STRIKE,
+    TAG_STRONG,
+    TAG_STYLE,
+    TAG_SUB,
+    TAG_SUMMARY,
+    TAG_SUP,
+    TAG_SVG,
+    TAG_TABLE,
+    TAG_TBODY,
+    TAG_TD,
+    TAG_TEMPLATE,
+    TAG_TEXTAREA,
+    TAG_TFOOT,
+    TAG_TH,
+    TAG_THEAD,
+    TAG_TIME,
+    TAG_TITLE,
+    TAG_TR,
+    TAG_TRACK,
+    TAG_TT,
+    TAG_U,
+    TAG_UL,
+    TAG_VAR,
+    TAG_VIDEO,
+    TAG_WBR,
+    TAG_XMP,
+    TAG_COUNT
+};
+
+/** Look up the id of a lowercase element name.
+ *
+ *  Returns TAG_UNKNOWN for names which aren't HTML elements.
+ */
+HtmlTagId html_tag_lookup(const char *p, size_t len);
+
+/// Return the lowercase name for an id ("" for TAG_UNKNOWN).
+const char * html_tag_name(HtmlTagId id);
+
+/// Return the length of html_tag_name(id).
+size_t html_tag_name_len(HtmlTagId id);
+
+#endif // OMEGA_INCLUDED_HTMLTAGS_H
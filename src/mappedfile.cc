@@ -0,0 +1,105 @@
+/* mappedfile.cc: read-only access to the contents of a file.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#include <config.h>
+
+#include "mappedfile.h"
+
+#include <stdio.h>
+#include "safeerrno.h"
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+bool
+MappedFile::open(const std::string &path)
+{
+    close();
+#ifdef HAVE_SYS_MMAN_H
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+	int saved_errno = errno;
+	::close(fd);
+	errno = saved_errno;
+	return false;
+    }
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+	void * p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (p != MAP_FAILED) {
+	    ::close(fd);
+#ifdef MADV_SEQUENTIAL
+	    madvise(p, st.st_size, MADV_SEQUENTIAL);
+#endif
+	    data_ = static_cast<const char *>(p);
+	    size_ = st.st_size;
+	    mapped = true;
+	    return true;
+	}
+    }
+    // Empty files can't be mapped, and some (such as pipes) have no size,
+    // so just read them.
+    char chunk[4096];
+    ssize_t n;
+    while ((n = read(fd, chunk, sizeof(chunk))) != 0) {
+	if (n < 0) {
+	    if (errno == EINTR) continue;
+	    int saved_errno = errno;
+	    ::close(fd);
+	    errno = saved_errno;
+	    return false;
+	}
+	buf.append(chunk, n);
+    }
+    ::close(fd);
+#else
+    FILE * fh = fopen(path.c_str(), "rb");
+    if (fh == NULL) return false;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), fh)) != 0)
+	buf.append(chunk, n);
+    if (ferror(fh)) {
+	int saved_errno = errno;
+	fclose(fh);
+	errno = saved_errno;
+	return false;
+    }
+    fclose(fh);
+#endif
+    data_ = buf.data();
+    size_ = buf.size();
+    return true;
+}
+
+void
+MappedFile::close()
+{
+#ifdef HAVE_SYS_MMAN_H
+    if (mapped) munmap(const_cast<char *>(data_), size_);
+#endif
+    mapped = false;
+    data_ = NULL;
+    size_ = 0;
+    std::string().swap(buf);
+}
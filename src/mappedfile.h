@@ -0,0 +1,57 @@
+/* mappedfile.h: read-only access to the contents of a file.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_MAPPEDFILE_H
+#define OMEGA_INCLUDED_MAPPEDFILE_H
+
+#include <string>
+
+/** The contents of a file, memory-mapped where possible.
+ *
+ *  The mapping is read-only and advised for sequential access.  Where
+ *  mmap() isn't available (or the file is empty), the contents are read
+ *  into memory instead.
+ */
+class MappedFile {
+	const char * data_;
+	size_t size_;
+	bool mapped;
+	std::string buf;
+
+	// Not copyable.
+	MappedFile(const MappedFile &);
+	void operator=(const MappedFile &);
+
+    public:
+	MappedFile() : data_(NULL), size_(0), mapped(false) { }
+	~MappedFile() { close(); }
+
+	/** Open a file.
+	 *
+	 *  Returns false (with errno set) if the file can't be read.
+	 */
+	bool open(const std::string &path);
+
+	/// Release the contents of the file.
+	void close();
+
+	const char * data() const { return data_; }
+	size_t size() const { return size_; }
+};
+
+#endif // OMEGA_INCLUDED_MAPPEDFILE_H
@@ -43,10 +43,10 @@ MetaXmlParser::process_text(const string &text)
     }
 }
 
-void
+bool
 MetaXmlParser::opening_tag(const string &tag, const map<string,string> &)
 {
-    if (tag.size() < 8) return;
+    if (tag.size() < 8) return true;
     if (tag[0] == 'd' && tag[1] == 'c') {
 	if (tag == "dc:subject") {
 	    // dc:subject is "Subject and Keywords":
@@ -68,10 +68,12 @@ MetaXmlParser::opening_tag(const string &tag, const map<string,string> &)
 	// </meta:keywords>
 	if (tag == "meta:keyword") field = KEYWORDS;
     }
+    return true;
 }
 
-void
+bool
 MetaXmlParser::closing_tag(const string &)
 {
     field = NONE;
+    return true;
 }
@@ -27,8 +27,8 @@ class MetaXmlParser : public HtmlParser {
   public:
     MetaXmlParser() { }
     void process_text(const string &text);
-    void opening_tag(const string &tag, const map<string,string> &);
-    void closing_tag(const string &tag);
+    bool opening_tag(const string &tag, const map<string,string> &);
+    bool closing_tag(const string &tag);
     string title, keywords, sample;
 };
 
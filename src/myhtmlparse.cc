@@ -24,8 +24,14 @@
 
 #include "myhtmlparse.h"
 
+#include "mappedfile.h"
+#include "sniffcharset.h"
+
+#include <algorithm>
+
 #include <ctype.h>
 #include <string.h>
+#include "strcasecmp.h"
 
 inline void
 lowercase_string(string &str)
@@ -35,70 +41,318 @@ lowercase_string(string &str)
     }
 }
 
+inline bool
+equals_nocase(const StringView &s, const char *lower)
+{
+    size_t len = strlen(lower);
+    return s.size() == len && strncasecmp(s.data(), lower, len) == 0;
+}
+
+HtmlArena::~HtmlArena()
+{
+    std::vector<HtmlTagNode *>::const_iterator i;
+    for (i = node_blocks.begin(); i != node_blocks.end(); ++i)
+	delete [] *i;
+}
+
+HtmlTagNode *
+HtmlArena::new_node(const StringView &name, HtmlTagId tag_id,
+		    HtmlTagNode * parent)
+{
+    HtmlTagNode * node;
+    if (!free_nodes.empty()) {
+	node = free_nodes.back();
+	free_nodes.pop_back();
+    } else {
+	size_t block = nodes_used / BLOCK_SIZE;
+	if (block == node_blocks.size())
+	    node_blocks.push_back(new HtmlTagNode[BLOCK_SIZE]);
+	node = node_blocks[block] + nodes_used % BLOCK_SIZE;
+	++nodes_used;
+    }
+    node->tag.name.assign(name.data(), name.size());
+    node->tag.tag_id = tag_id;
+    node->tag.cls.resize(0);
+    node->tag.id.resize(0);
+    node->parent = parent;
+    node->kept = false;
+    return node;
+}
+
+void
+HtmlLink::get_parent_tags(std::vector<const HtmlTag *> &tags) const
+{
+    tags.clear();
+    for (const HtmlTagNode * node = parent(); node; node = node->parent)
+	tags.push_back(&node->tag);
+    std::reverse(tags.begin(), tags.end());
+}
+
+void
+HtmlLinkTable::add(const StringView &target, unsigned start_pos,
+		   const HtmlTagNode * parent_)
+{
+    target_offset.push_back(pool.size());
+    pool.append(target.data(), target.size());
+    text_offset.push_back(pool.size());
+    para.push_back(-1);
+    start.push_back(start_pos);
+    parent.push_back(parent_);
+    child_offset.push_back(children.size());
+}
+
+int
+HtmlLinkTable::add_para(const StringView &text)
+{
+    para_offset.push_back(para_text.size());
+    para_text.append(text.data(), text.size());
+    return int(para_offset.size() - 1);
+}
+
+void
+HtmlLinkTable::clear()
+{
+    pool.resize(0);
+    target_offset.clear();
+    text_offset.clear();
+    para.clear();
+    start.clear();
+    parent.clear();
+    child_offset.clear();
+    children.clear();
+    para_text.resize(0);
+    para_offset.clear();
+}
+
+HtmlTagPolicy::HtmlTagPolicy()
+{
+    static const HtmlTagId block[] = {
+	TAG_ADDRESS, TAG_ARTICLE, TAG_ASIDE, TAG_BLOCKQUOTE, TAG_BR,
+	TAG_CAPTION, TAG_CENTER, TAG_DD, TAG_DETAILS, TAG_DIALOG, TAG_DIR,
+	TAG_DIV, TAG_DL, TAG_DT, TAG_EMBED, TAG_FIELDSET, TAG_FIGCAPTION,
+	TAG_FIGURE, TAG_FOOTER, TAG_FORM, TAG_H1, TAG_H2, TAG_H3, TAG_H4,
+	TAG_H5, TAG_H6, TAG_HEADER, TAG_HGROUP, TAG_HR, TAG_IFRAME, TAG_IMG,
+	TAG_INPUT, TAG_ISINDEX, TAG_KEYGEN, TAG_LEGEND, TAG_LI, TAG_LISTING,
+	TAG_MAIN, TAG_MARQUEE, TAG_MENU, TAG_MULTICOL, TAG_NAV, TAG_OL,
+	TAG_OPTION, TAG_P, TAG_PLAINTEXT, TAG_PRE, TAG_Q, TAG_SEARCH,
+	TAG_SECTION, TAG_SELECT, TAG_SUMMARY, TAG_TABLE, TAG_TD, TAG_TEXTAREA,
+	TAG_TH, TAG_UL, TAG_XMP
+    };
+    static const HtmlTagId void_[] = {
+	TAG_AREA, TAG_BASE, TAG_BASEFONT, TAG_BR, TAG_COL, TAG_EMBED,
+	TAG_FRAME, TAG_HR, TAG_IMG, TAG_INPUT, TAG_ISINDEX, TAG_KEYGEN,
+	TAG_LINK, TAG_META, TAG_PARAM, TAG_SOURCE, TAG_TRACK, TAG_WBR
+    };
+    memset(flags, 0, sizeof(flags));
+    size_t i;
+    for (i = 0; i != sizeof(block) / sizeof(block[0]); ++i)
+	flags[block[i]] |= TAG_IS_BLOCK;
+    for (i = 0; i != sizeof(void_) / sizeof(void_[0]); ++i)
+	flags[void_[i]] |= TAG_IS_VOID;
+    flags[TAG_SCRIPT] |= TAG_IS_RAW_TEXT;
+    flags[TAG_STYLE] |= TAG_IS_RAW_TEXT;
+    flags[TAG_NOSCRIPT] |= TAG_IS_IGNORED;
+    flags[TAG_TEMPLATE] |= TAG_IS_IGNORED;
+    flags[TAG_SVG] |= TAG_IS_IGNORED;
+}
+
+bool
+HtmlTagPolicy::set(const string & name, unsigned flags_)
+{
+    HtmlTagId id = html_tag_lookup(name.data(), name.size());
+    if (id == TAG_UNKNOWN) return false;
+    flags[id] = flags_;
+    return true;
+}
+
+// Mark node and the tags it's inside as kept, since a link refers to them.
+static void
+keep_node(HtmlTagNode * node)
+{
+    for ( ; node && !node->kept; node = node->parent)
+	node->kept = true;
+}
+
 MyHtmlParser::~MyHtmlParser()
 {
-    std::vector<HtmlLink*>::const_iterator i;
-    for (i = links.begin(); i != links.end(); ++i)
-	delete *i;
+    arena->clear();
 }
 
 void
 MyHtmlParser::parse_html(const string &text)
 {
+    parse_html(text.data(), text.size());
+}
+
+void
+MyHtmlParser::parse_html(const string &text, const string &charset_)
+{
+    parse_html(text.data(), text.size(), charset_);
+}
+
+void
+MyHtmlParser::parse_html(const char *data, size_t len)
+{
+    reset();
+    start_parse(data, len);
+}
+
+void
+MyHtmlParser::parse_html(const char *data, size_t len, const string &charset_)
+{
+    reset();
+    fix_charset(charset_);
+    start_parse(data, len);
+}
+
+void
+MyHtmlParser::start_parse(const char *data, size_t len)
+{
+    if (!metadata_only &&
+	(fields & (FIELD_CONTENT | FIELD_LINKS | FIELD_LINK_CONTEXT |
+		   FIELD_PARASTARTS))) {
+	// Text is usually a small part of a page, so start with room for a
+	// quarter of its size, to save reallocating dump as it grows.  Only
+	// grow it, since a smaller reserve() can shrink the buffer a reused
+	// parser is keeping.
+	if (len / 4 > dump.capacity()) dump.reserve(len / 4);
+    }
+    HtmlParser::parse_html(data, len);
+    end_parse();
+}
+
+void
+MyHtmlParser::reset()
+{
+    HtmlParser::reset();
     // Default HTML character set is latin 1, though not specifying one is
     // deprecated these days.
     charset = "ISO-8859-1";
     fixed_charset = false;
-    try {
-	HtmlParser::parse_html(text);
-    } catch(bool) {
-    }
-    new_para();
-    int i;
-    for (i = tags.size() - 1; i >= 0; --i) {
-	if (tags[i].name == "a") close_link();
-    }
+    in_script_tag = false;
+    in_style_tag = false;
+    pending_space = false;
+    title.resize(0);
+    sample.resize(0);
+    keywords.resize(0);
+    indexing_allowed = true;
+    links.clear();
+    arena->clear();
+    stop_reason = STOP_NONE;
+    open_tags = NULL;
+    open_depth = 0;
+    memset(open_count, 0, sizeof(open_count));
+    paralinks.clear();
+    in_link = false;
+    link_text_start = 0;
+    in_title = false;
+    start_dump();
+}
+
+bool
+MyHtmlParser::parse_file(const string &path)
+{
+    MappedFile file;
+    if (!file.open(path)) return false;
+    parse_html(file.data(), file.size());
+    return true;
 }
 
 void
-MyHtmlParser::parse_html(const string &text, const string &charset_)
+MyHtmlParser::fix_charset(const string &charset_)
 {
     charset = charset_;
     fixed_charset = true;
-    try{
-	HtmlParser::parse_html(text);
-    } catch(bool) {
+}
+
+void
+MyHtmlParser::finish()
+{
+    HtmlParser::finish();
+    end_parse();
+}
+
+void
+MyHtmlParser::end_parse()
+{
+    if (metadata_only) {
+	// Only the head was parsed, so there are no paragraphs.
+	parastarts.clear();
+	return;
     }
     new_para();
-    int i;
-    for (i = tags.size() - 1; i >= 0; --i) {
-	if (tags[i].name == "a") close_link();
+    // A link still open at the end may not be in open_tags, if it was
+    // opened beyond max_depth.
+    close_link();
+    if (!(fields & FIELD_CONTENT)) dump.resize(0);
+    if (!(fields & FIELD_TITLE)) title.resize(0);
+    if (!(fields & FIELD_PARASTARTS)) parastarts.clear();
+}
+
+void
+MyHtmlParser::prescan(const char *p, size_t len, bool bom)
+{
+    if (fixed_charset) return;
+    if (bom) {
+	// A byte order mark overrides any declaration in the document.
+	charset = "UTF-8";
+	fixed_charset = true;
+	return;
     }
+    string declared;
+    if (sniff_charset(p, len, declared)) charset = declared;
 }
 
 void
-MyHtmlParser::process_text(const string &text)
-{
-    if (!text.empty() && !in_script_tag && !in_style_tag) {
-	string::size_type b = text.find_first_not_of(WHITESPACE);
-	if (b) pending_space = true;
-	while (b != string::npos) {
-	    if (pending_space && !dump.empty()) {
-		if (parastart == dump.size())
-		    parastart += 1;
-		if (link_text_start == dump.size())
-		    link_text_start += 1;
-		dump += ' ';
-	    }
-	    string::size_type e = text.find_first_of(WHITESPACE, b);
-	    pending_space = (e != string::npos);
-	    if (!pending_space) {
-		dump.append(text.data() + b, text.size() - b);
-		return;
-	    }
-	    dump.append(text.data() + b, e - b);
-	    b = text.find_first_not_of(WHITESPACE, e + 1);
+MyHtmlParser::xml_declaration(const string &charset_)
+{
+    // A byte order mark or the caller's character set wins.
+    if (!fixed_charset) charset = charset_;
+}
+
+bool
+MyHtmlParser::skip_content(HtmlTagId id) const
+{
+    unsigned mask = TAG_IS_RAW_TEXT;
+    if (skip_hidden_content) mask |= TAG_IS_IGNORED;
+    return (tag_policy.get(id) & mask) != 0;
+}
+
+void
+MyHtmlParser::process_undecoded_text(const StringView &text, bool has_amp)
+{
+    if (in_script_tag || in_style_tag) return;
+
+    if (metadata_only) {
+	if (in_title) {
+	    append_collapsed(title, text, has_amp, pending_space,
+			     collapse_unicode_spaces);
+	} else if (text.find_first_not_of(WHITESPACE) != StringView::npos) {
+	    // Text outside the title means the body has started.
+	    stop_reason = STOP_HEAD_END;
+	    stopped = true;
 	}
+	return;
+    }
+
+    // Skip text which can't end up in any of the wanted fields.  Link text
+    // and paragraph starts depend on all the text before them, so need it
+    // all.
+    if (!(fields & (FIELD_CONTENT | FIELD_LINKS | FIELD_LINK_CONTEXT |
+		    FIELD_PARASTARTS)) &&
+	!((fields & FIELD_TITLE) && title.empty()))
+	return;
+
+    string::size_type old_size = dump.size();
+    append_collapsed(dump, text, has_amp, pending_space,
+		     collapse_unicode_spaces);
+    // A space separating this text from what came before doesn't belong to
+    // a paragraph or link text starting here.
+    if (dump.size() != old_size && dump[old_size] == ' ') {
+	if (parastart == old_size)
+	    parastart += 1;
+	if (link_text_start == old_size)
+	    link_text_start += 1;
     }
 }
 
@@ -114,15 +368,18 @@ MyHtmlParser::new_para()
 {
     if (!dump.empty())
         dump += '\n';
-    std::string paratext = dump.substr(parastart);
-    std::vector<HtmlLink*>::const_iterator i;
-    for (i = paralinks.begin(); i != paralinks.end(); ++i) {
-	(*i)->para = paratext;
+    if (!paralinks.empty()) {
+	int para = links.add_para(StringView(dump).substr(parastart));
+	std::vector<size_t>::const_iterator i;
+	for (i = paralinks.begin(); i != paralinks.end(); ++i) {
+	    links.para[*i] = para;
+	}
+	paralinks.clear();
     }
-    paralinks.clear();
 
     parastart = dump.size();
-    parastarts.push_back(parastart);
+    if (fields & FIELD_PARASTARTS)
+	parastarts.push_back(parastart);
 }
 
 void
@@ -130,339 +387,397 @@ MyHtmlParser::start_dump()
 {
     dump = "";
     parastart = 0;
+    // Any open link's text starts afresh too.
+    link_text_start = 0;
     parastarts.clear();
     parastarts.push_back(parastart);
 }
 
-bool
-get_autocloses(const string & tag)
+// Return the tags which opening a tag with the given id implicitly ends,
+// terminated by TAG_UNKNOWN, or NULL if there are none.
+static const HtmlTagId *
+get_implied_ends(HtmlTagId id)
 {
-    // Set to true if the tag doesn't expect a matching close tag (like br)
-    switch (tag[0]) {
-	case 'a':
-	    if (tag == "area") return true;
-	    break;
-	case 'b':
-	    if (tag == "base" ||
-		tag == "basefont" ||
-		tag == "br") return true;
-	    break;
-	case 'c':
-	    if (tag == "col") return true;
-	    break;
-	case 'f':
-	    if (tag == "frame") return true;
-	    break;
-	case 'h':
-	    if (tag == "hr") return true;
-	    break;
-	case 'i':
-	    if (tag == "img" ||
-		tag == "input" ||
-		tag == "isindex") return true;
-	    break;
-	case 'l':
-	    if (tag == "link") return true;
-	    break;
-	case 'm':
-	    if (tag == "meta") return true;
-	    break;
-	case 'p':
-	    if (tag == "param") return true;
-	    break;
+    static const HtmlTagId p[] = { TAG_P, TAG_UNKNOWN };
+    static const HtmlTagId a[] = { TAG_A, TAG_UNKNOWN };
+    static const HtmlTagId li[] = { TAG_P, TAG_LI, TAG_UNKNOWN };
+    static const HtmlTagId dd[] = { TAG_P, TAG_DD, TAG_DT, TAG_UNKNOWN };
+    static const HtmlTagId option[] = { TAG_OPTION, TAG_UNKNOWN };
+    static const HtmlTagId optgroup[] = {
+	TAG_OPTION, TAG_OPTGROUP, TAG_UNKNOWN
+    };
+    static const HtmlTagId cell[] = { TAG_TD, TAG_TH, TAG_UNKNOWN };
+    static const HtmlTagId tr[] = { TAG_TR, TAG_TD, TAG_TH, TAG_UNKNOWN };
+    static const HtmlTagId tbody[] = {
+	TAG_TBODY, TAG_THEAD, TAG_TFOOT, TAG_TR, TAG_TD, TAG_TH, TAG_UNKNOWN
+    };
+    switch (id) {
+	case TAG_ADDRESS: case TAG_ARTICLE: case TAG_ASIDE:
+	case TAG_BLOCKQUOTE: case TAG_CENTER: case TAG_DETAILS:
+	case TAG_DIALOG: case TAG_DIR: case TAG_DIV: case TAG_DL:
+	case TAG_FIELDSET: case TAG_FIGCAPTION: case TAG_FIGURE:
+	case TAG_FOOTER: case TAG_FORM: case TAG_H1: case TAG_H2: case TAG_H3:
+	case TAG_H4: case TAG_H5: case TAG_H6: case TAG_HEADER:
+	case TAG_HGROUP: case TAG_HR: case TAG_LISTING: case TAG_MAIN:
+	case TAG_MENU: case TAG_NAV: case TAG_OL: case TAG_P:
+	case TAG_PLAINTEXT: case TAG_PRE: case TAG_SECTION: case TAG_TABLE:
+	case TAG_UL: case TAG_XMP:
+	    return p;
+	case TAG_A:
+	    return a;
+	case TAG_LI:
+	    return li;
+	case TAG_DD: case TAG_DT:
+	    return dd;
+	case TAG_OPTION:
+	    return option;
+	case TAG_OPTGROUP:
+	    return optgroup;
+	case TAG_TD: case TAG_TH:
+	    return cell;
+	case TAG_TR:
+	    return tr;
+	case TAG_TBODY: case TAG_THEAD: case TAG_TFOOT:
+	    return tbody;
+	default:
+	    return NULL;
     }
-    return false;
 }
 
-void
-MyHtmlParser::opening_tag(const string &tag, const map<string,string> &p)
+static bool
+is_heading(HtmlTagId id)
 {
-#if 0
-    cout << "<" << tag;
-    map<string, string>::const_iterator x;
-    for (x = p.begin(); x != p.end(); x++) {
-	cout << " " << x->first << "=\"" << x->second << "\"";
+    return id >= TAG_H1 && id <= TAG_H6;
+}
+
+// Does an open tag with id open_id stop the search for tags which opening
+// id implicitly ends?  This follows HTML5's scopes, except that we don't
+// reconstruct formatting elements, so an open link is always a boundary
+// (otherwise <p><a href=x>y<p>z would cut the link short).
+static bool
+is_scope_boundary(HtmlTagId id, HtmlTagId open_id)
+{
+    switch (open_id) {
+	case TAG_A: case TAG_APPLET: case TAG_BUTTON: case TAG_CAPTION:
+	case TAG_HTML: case TAG_MARQUEE: case TAG_OBJECT: case TAG_TABLE:
+	case TAG_TEMPLATE:
+	    return true;
+	case TAG_TD: case TAG_TH:
+	    switch (id) {
+		case TAG_TD: case TAG_TH: case TAG_TR: case TAG_TBODY:
+		case TAG_THEAD: case TAG_TFOOT:
+		    return false;
+		default:
+		    return true;
+	    }
+	case TAG_OL: case TAG_UL:
+	    return id == TAG_LI;
+	case TAG_DL:
+	    return id == TAG_DD || id == TAG_DT;
+	case TAG_SELECT:
+	    return id == TAG_OPTION || id == TAG_OPTGROUP;
+	default:
+	    return false;
     }
-    cout << ">\n";
-#endif
-    if (tag.empty()) return;
+}
 
-    HtmlTag htmltag(tag);
-    {
-	map<string, string>::const_iterator i;
-	if ((i = p.find("class")) != p.end()) {
-	    htmltag.cls = i->second;
-	}
-	if ((i = p.find("id")) != p.end()) {
-	    htmltag.id = i->second;
+void
+MyHtmlParser::push_tag(HtmlTagNode * node)
+{
+    open_tags = node;
+    ++open_depth;
+    ++open_count[node->tag.tag_id];
+}
+
+// Close any open tags which opening a tag with the given id implicitly
+// ends, so that <p>x<p>y gives two paragraphs rather than one inside the
+// other.
+void
+MyHtmlParser::close_implied_tags(HtmlTagId id)
+{
+    const HtmlTagId * ends = get_implied_ends(id);
+    if (ends) {
+	// Usually none of the tags are open, and we needn't look further.
+	const HtmlTagId * e = ends;
+	while (*e != TAG_UNKNOWN && open_count[*e] == 0) ++e;
+	HtmlTagNode * node = (*e != TAG_UNKNOWN) ? open_tags : NULL;
+	while (node) {
+	    HtmlTagId open_id = node->tag.tag_id;
+	    for (e = ends; *e != TAG_UNKNOWN && *e != open_id; ++e) { }
+	    if (*e != TAG_UNKNOWN) {
+		close_tags(node);
+		node = open_tags;
+	    } else if (is_scope_boundary(id, open_id)) {
+		break;
+	    } else {
+		node = node->parent;
+	    }
 	}
     }
-    if (!get_autocloses(tag)) {
-	tags.push_back(htmltag);
-    }
-    if (currlink != NULL && tag != "a") {
-	currlink->child_tags.push_back(htmltag);
-    }
-    switch (tag[0]) {
-	case 'a':
-	    if (tag == "a") {
-		close_link();
-		HtmlLink * link = new HtmlLink;
-		links.push_back(link);
-		paralinks.push_back(link);
-
-		map<string, string>::const_iterator i;
-		if ((i = p.find("href")) != p.end()) {
-		    link->target = i->second;
+    // A heading directly inside another ends it.
+    if (is_heading(id) && open_tags && is_heading(open_tags->tag.tag_id))
+	close_tags(open_tags);
+}
+
+bool
+MyHtmlParser::process_meta(const HtmlAttributes &p)
+{
+    const StringView * i, * j;
+    if ((i = p.find("content")) != NULL) {
+	if ((j = p.find("name")) != NULL) {
+	    // Robots is always needed, whatever fields are wanted.
+	    if (equals_nocase(*j, "robots")) {
+		string val = i->str();
+		decode_entities(val);
+		lowercase_string(val);
+		if (val.find("none") != string::npos ||
+		    val.find("noindex") != string::npos) {
+		    indexing_allowed = false;
+		    stop_reason = STOP_NOINDEX;
+		    return false;
 		}
-		link->parent_tags = tags;
-		link_text_start = dump.size();
-		link->start_pos = link_text_start;
-		currlink = link;
-	    }
-	    if (tag == "address") new_para();
-	    break;
-	case 'b':
-	    if (tag == "body") {
-		new_para();
-		start_dump();
-		break;
+	    } else if (!(fields & FIELD_META)) {
+		// Description and keywords aren't wanted.
+	    } else if (equals_nocase(*j, "description")) {
+		if (sample.empty()) {
+		    sample = i->str();
+		    decode_entities(sample);
+		}
+	    } else if (equals_nocase(*j, "keywords")) {
+		if (!keywords.empty()) keywords += ' ';
+		string tmp = i->str();
+		decode_entities(tmp);
+		keywords += tmp;
 	    }
-	    if (tag == "blockquote" || tag == "br") new_para();
-	    break;
-	case 'c':
-	    if (tag == "center") new_para();
-	    break;
-	case 'd':
-	    if (tag == "dd" || tag == "dir" || tag == "div" || tag == "dl" ||
-		tag == "dt") new_para();
-	    break;
-	case 'e':
-	    if (tag == "embed") new_para();
-	    break;
-	case 'f':
-	    if (tag == "fieldset" || tag == "form") new_para();
-	    break;
-	case 'h':
-	    // hr, and h1, ..., h6
-	    if (tag.length() == 2 && strchr("r123456", tag[1]))
-		new_para();
-	    break;
-	case 'i':
-	    if (tag == "iframe" || tag == "img" || tag == "isindex" ||
-		tag == "input") new_para();
-	    break;
-	case 'k':
-	    if (tag == "keygen") new_para();
-	    break;
-	case 'l':
-	    if (tag == "legend" || tag == "li" || tag == "listing")
-		new_para();
-	    break;
-	case 'm':
-	    if (tag == "meta") {
-		map<string, string>::const_iterator i, j;
-		if ((i = p.find("content")) != p.end()) {
-		    if ((j = p.find("name")) != p.end()) {
-			string name = j->second;
-			lowercase_string(name);
-			if (name == "description") {
-			    if (sample.empty()) {
-				sample = i->second;
-				decode_entities(sample);
-			    }
-			} else if (name == "keywords") {
-			    if (!keywords.empty()) keywords += ' ';
-			    string tmp = i->second;
-			    decode_entities(tmp);
-			    keywords += tmp;
-			} else if (name == "robots") {
-			    string val = i->second;
-			    decode_entities(val);
-			    lowercase_string(val);
-			    if (val.find("none") != string::npos ||
-				val.find("noindex") != string::npos) {
-				indexing_allowed = false;
-				throw true;
-			    }
+	}
+	if ((j = p.find("http-equiv")) != NULL) {
+	    if (equals_nocase(*j, "content-type")) {
+		if (!fixed_charset) {
+		    string value = i->str();
+		    lowercase_string(value);
+		    size_t start = value.find("charset=");
+		    if (start == string::npos) return true;
+		    start += 8;
+		    if (start == value.size()) return true;
+		    size_t end = start;
+		    if (value[start] != '"') {
+			while (end < value.size()) {
+			    unsigned char ch = value[end];
+			    if (ch <= 32 || ch >= 127 ||
+				strchr(";()<>@,:\\\"/[]?={}", ch))
+				break;
+			    ++end;
 			}
-		    }
-		    if ((j = p.find("http-equiv")) != p.end()) {
-			string hdr = j->second;
-			lowercase_string(hdr);
-			if (hdr == "content-type") {
-			    if (!fixed_charset) {
-				string value = i->second;
-				lowercase_string(value);
-				size_t start = value.find("charset=");
-				if (start == string::npos) break;
-				start += 8;
-				if (start == value.size()) break;
-				size_t end = start;
-				if (value[start] != '"') {
-				    while (end < value.size()) {
-					unsigned char ch = value[end];
-					if (ch <= 32 || ch >= 127 ||
-					    strchr(";()<>@,:\\\"/[]?={}", ch))
-					    break;
-					++end;
-				    }
-				} else {
-				    ++start;
-				    ++end;
-				    while (end < value.size()) {
-					unsigned char ch = value[end];
-					if (ch == '"') break;
-					if (ch == '\\') value.erase(end, 1);
-					++end;
-				    }
-				}
-				charset = value.substr(start, end - start);
-			    }
+		    } else {
+			++start;
+			++end;
+			while (end < value.size()) {
+			    unsigned char ch = value[end];
+			    if (ch == '"') break;
+			    if (ch == '\\') value.erase(end, 1);
+			    ++end;
 			}
 		    }
+		    charset = value.substr(start, end - start);
 		}
-		break;
 	    }
-	    if (tag == "marquee" || tag == "menu" || tag == "multicol")
-		new_para();
+	}
+    }
+    return true;
+}
+
+bool
+MyHtmlParser::head_opening_tag(HtmlTagId id, const HtmlAttributes &p)
+{
+    switch (id) {
+	case TAG_META:
+	    return process_meta(p);
+	case TAG_TITLE:
+	    // Only the first title counts.
+	    in_title = title.empty();
+	    pending_space = false;
+	    return true;
+	case TAG_STYLE:
+	    in_style_tag = true;
+	    return true;
+	case TAG_SCRIPT:
+	    in_script_tag = true;
+	    return true;
+	case TAG_HTML: case TAG_HEAD: case TAG_BASE: case TAG_BASEFONT:
+	case TAG_BGSOUND: case TAG_LINK: case TAG_NOSCRIPT: case TAG_TEMPLATE:
+	    return true;
+	default:
+	    stop_reason = STOP_HEAD_END;
+	    return false;
+    }
+}
+
+bool
+MyHtmlParser::head_closing_tag(HtmlTagId id)
+{
+    switch (id) {
+	case TAG_TITLE:
+	    in_title = false;
 	    break;
-	case 'o':
-	    if (tag == "ol" || tag == "option") new_para();
+	case TAG_STYLE:
+	    in_style_tag = false;
 	    break;
-	case 'p':
-	    if (tag == "p" || tag == "pre" || tag == "plaintext")
-		new_para();
+	case TAG_SCRIPT:
+	    in_script_tag = false;
 	    break;
-	case 'q':
-	    if (tag == "q") new_para();
+	case TAG_HEAD: case TAG_BODY: case TAG_HTML:
+	    stop_reason = STOP_HEAD_END;
+	    return false;
+	default:
 	    break;
-	case 's':
-	    if (tag == "style") {
-		in_style_tag = true;
-		break;
+    }
+    return true;
+}
+
+bool
+MyHtmlParser::opening_tag_view(const StringView &tag, HtmlTagId id,
+			       const HtmlAttributes &p)
+{
+#if 0
+    cout << "<" << tag.str();
+    for (size_t x = 0; x != p.size(); ++x) {
+	cout << " " << p.name(x).str() << "=\"" << p.value(x).str() << "\"";
+    }
+    cout << ">\n";
+#endif
+    if (tag.empty()) return true;
+    if (metadata_only) return head_opening_tag(id, p);
+
+    // The stack of open tags is only needed to find where links end, and
+    // to give their context.
+    if (fields & FIELD_LINKS) {
+	close_implied_tags(id);
+	bool push = !(tag_policy.get(id) & TAG_IS_VOID) &&
+		    open_depth < max_depth;
+	bool is_child = (fields & FIELD_LINK_CONTEXT) &&
+			in_link && id != TAG_A;
+	if (push || is_child) {
+	    HtmlTagNode * node = arena->new_node(tag, id, open_tags);
+	    if (fields & FIELD_LINK_CONTEXT) {
+		const StringView * i;
+		if ((i = p.find("class")) != NULL) {
+		    node->tag.cls.assign(i->data(), i->size());
+		}
+		if ((i = p.find("id")) != NULL) {
+		    node->tag.id.assign(i->data(), i->size());
+		}
 	    }
-	    if (tag == "script") {
-		in_script_tag = true;
-		break;
+	    if (is_child) {
+		keep_node(node);
+		links.add_child(node);
 	    }
-	    if (tag == "select") new_para();
+	    if (push) push_tag(node);
+	}
+    }
+    switch (id) {
+	case TAG_A: {
+	    close_link();
+	    if (!(fields & FIELD_LINKS)) break;
+	    StringView target;
+	    const StringView * i;
+	    if ((i = p.find("href")) != NULL) {
+		target = *i;
+	    }
+	    HtmlTagNode * parent = NULL;
+	    if (fields & FIELD_LINK_CONTEXT) {
+		paralinks.push_back(links.size());
+		keep_node(open_tags);
+		parent = open_tags;
+	    }
+	    link_text_start = dump.size();
+	    links.add(target, link_text_start, parent);
+	    in_link = true;
 	    break;
-	case 't':
-	    if (tag == "table" || tag == "td" || tag == "textarea" ||
-		tag == "th") new_para();
+	}
+	case TAG_BODY:
+	    new_para();
+	    start_dump();
 	    break;
-	case 'u':
-	    if (tag == "ul") new_para();
+	case TAG_META:
+	    if (!process_meta(p)) return false;
 	    break;
-	case 'x':
-	    if (tag == "xmp") new_para();
+	case TAG_STYLE:
+	    in_style_tag = true;
+	    break;
+	case TAG_SCRIPT:
+	    in_script_tag = true;
+	    break;
+	default:
 	    break;
     }
+    if (tag_policy.get(id) & TAG_IS_BLOCK) new_para();
+    return true;
 }
 
 void
 MyHtmlParser::close_link()
 {
-    if (currlink == NULL) return;
-    map<string, string>::const_iterator i;
-    if (links.size() == 0)
-	return;
-    HtmlLink * link = links[links.size() - 1];
+    if (!in_link) return;
     if (dump.size() > link_text_start) {
-	link->text = dump.substr(link_text_start);
+	links.set_text(StringView(dump).substr(link_text_start));
     }
-    currlink = NULL;
+    in_link = false;
 }
 
+// Close node and any tags inside it.
 void
-MyHtmlParser::closing_tag(const string &tag)
-{
-    if (tag.empty()) return;
-    int i;
-    for (i = tags.size() - 1; i >= 0; --i) {
-	if (tags[i].name == tag) {
-	    if (currlink != NULL) {
-		for (int j = tags.size() - 1; j >= i; --j) {
-		    if (tags[j].name == "a") close_link();
-		}
-	    }
-	    tags.resize(i);
+MyHtmlParser::close_tags(HtmlTagNode * node)
+{
+    HtmlTagNode * end = node->parent;
+    while (open_tags != end) {
+	HtmlTagNode * closed = open_tags;
+	HtmlTagId closed_id = closed->tag.tag_id;
+	if (closed_id == TAG_A) close_link();
+	--open_count[closed_id];
+	--open_depth;
+	open_tags = closed->parent;
+	arena->release_node(closed);
+    }
+}
+
+bool
+MyHtmlParser::closing_tag_view(const StringView &tag, HtmlTagId id)
+{
+    if (tag.empty()) return true;
+    if (metadata_only) return head_closing_tag(id);
+    // Most stray close tags have no open tag with the same id, so can be
+    // ignored without searching.
+    HtmlTagNode * node = open_count[id] ? open_tags : NULL;
+    for ( ; node; node = node->parent) {
+	if (node->tag.tag_id == id &&
+	    (id != TAG_UNKNOWN || StringView(node->tag.name) == tag)) {
+	    close_tags(node);
 	    break;
 	}
     }
-    switch (tag[0]) {
-	case 'a':
-	    if (tag == "a") close_link();
-	    if (tag == "address") new_para();
-	    break;
-	case 'b':
-	    if (tag == "body") {
-		throw true;
-	    }
-	    if (tag == "blockquote" || tag == "br") new_para();
-	    break;
-	case 'c':
-	    if (tag == "center") new_para();
-	    break;
-	case 'd':
-	    if (tag == "dd" || tag == "dir" || tag == "div" || tag == "dl" ||
-		tag == "dt") new_para();
-	    break;
-	case 'f':
-	    if (tag == "fieldset" || tag == "form") new_para();
-	    break;
-	case 'h':
-	    // hr, and h1, ..., h6
-	    if (tag.length() == 2 && strchr("r123456", tag[1]))
-		new_para();
-	    break;
-	case 'i':
-	    if (tag == "iframe") new_para();
-	    break;
-	case 'l':
-	    if (tag == "legend" || tag == "li" || tag == "listing")
-		new_para();
-	    break;
-	case 'm':
-	    if (tag == "marquee" || tag == "menu") new_para();
-	    break;
-	case 'o':
-	    if (tag == "ol" || tag == "option") new_para();
-	    break;
-	case 'p':
-	    if (tag == "p" || tag == "pre") new_para();
-	    break;
-	case 'q':
-	    if (tag == "q") new_para();
-	    break;
-	case 's':
-	    if (tag == "style") {
-		in_style_tag = false;
-		break;
-	    }
-	    if (tag == "script") {
-		in_script_tag = false;
-		break;
-	    }
-	    if (tag == "select") new_para();
-	    break;
-	case 't':
-	    if (tag == "title") {
-		if (title.empty()) {
-		    title = dump;
-		    start_dump();
-		}
-		break;
+    switch (id) {
+	case TAG_A:
+	    close_link();
+	    break;
+	case TAG_BODY:
+	    stop_reason = STOP_BODY_END;
+	    return false;
+	case TAG_STYLE:
+	    in_style_tag = false;
+	    break;
+	case TAG_SCRIPT:
+	    in_script_tag = false;
+	    break;
+	case TAG_TITLE:
+	    if (title.empty()) {
+		// Copy rather than swap, so dump keeps its buffer.
+		title.assign(dump);
+		start_dump();
 	    }
-	    if (tag == "table" || tag == "td" || tag == "textarea" ||
-		tag == "th") new_para();
-	    break;
-	case 'u':
-	    if (tag == "ul") new_para();
 	    break;
-	case 'x':
-	    if (tag == "xmp") new_para();
+	default:
 	    break;
     }
+    if (tag_policy.get(id) & TAG_IS_BLOCK) new_para();
+    return true;
 }
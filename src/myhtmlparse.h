@@ -26,43 +26,317 @@
 #include "htmlparse.h"
 #include <vector>
 
-// FIXME: Should we include \xa0 which is non-breaking space in iso-8859-1, but
-// not in all charsets and perhaps spans of all \xa0 should become a single
-// \xa0?
+#include <string.h>
+
+// Whitespace which is collapsed in text.  U+00A0 (non-breaking space) and the
+// other Unicode space separators are also collapsed if MyHtmlParser's
+// collapse_unicode_spaces is set.
 #define WHITESPACE " \t\n\r"
 
 struct HtmlTag {
     // Name of the tag.
     string name;
 
+    // Id of the tag's name (TAG_UNKNOWN if it isn't an HTML element).
+    HtmlTagId tag_id;
+
     // Class of the tag.
     string cls;
 
     // Id of the tag.
     string id;
 
-    HtmlTag() {}
-    HtmlTag(const string & name_) : name(name_) {}
+    HtmlTag() : tag_id(TAG_UNKNOWN) {}
+    HtmlTag(const string & name_, HtmlTagId tag_id_)
+	: name(name_), tag_id(tag_id_) {}
+};
+
+// A tag in the tree of tags which have been open.  A link points to the
+// innermost tag open where it starts, so links share their common ancestors
+// rather than each having a copy.
+struct HtmlTagNode {
+    HtmlTag tag;
+
+    // The tag this one is inside, or NULL.
+    HtmlTagNode * parent;
+
+    // True if a link refers to this tag, so it mustn't be reused when it
+    // closes.
+    bool kept;
+};
+
+class HtmlLinkTable;
+
+/// A link in an HtmlLinkTable, valid until the table next changes.
+class HtmlLink {
+	const HtmlLinkTable * table;
+	size_t i;
+
+    public:
+	HtmlLink(const HtmlLinkTable * table_, size_t i_)
+	    : table(table_), i(i_) { }
+
+	// Target URL of link
+	StringView target() const;
+
+	// Text in link
+	StringView text() const;
+
+	// Index of the paragraph containing link in the table (see
+	// HtmlLinkTable::get_para()), or -1 if it isn't known.
+	int para_index() const;
+
+	// Paragraph text containing link
+	StringView para() const;
+
+	// Start position of link in the document's text
+	unsigned start_pos() const;
+
+	// Innermost parent tag of link, which is the link tag itself, or NULL
+	// if it isn't known.  Its chain of parents gives the rest.
+	const HtmlTagNode * parent() const;
+
+	// Set tags to the parent tags of the link, outermost first, and ending
+	// with the link tag itself.
+	void get_parent_tags(std::vector<const HtmlTag *> &tags) const;
+
+	// Child tags, in order of starting (not necessarily nested).
+	size_t child_tag_count() const;
+	const HtmlTag & child_tag(size_t k) const;
+};
+
+/** The links found in a document.
+ *
+ *  Rather than an object for each link, the table keeps an array for each
+ *  field, indexed by link number, with the targets and text of all the links
+ *  end to end in one string, so it needs only a few allocations however
+ *  many links there are.  Links are read through HtmlLink.
+ */
+class HtmlLinkTable {
+	friend class HtmlLink;
+	friend class MyHtmlParser;
+
+	// The target and then the text of each link, end to end.  A link's
+	// text runs up to the next link's target.
+	string pool;
+
+	// The fields of each link: the offsets of its target and text in pool,
+	// its paragraph, start position, and parent tag, and the offset of its
+	// child tags in children.
+	std::vector<unsigned> target_offset;
+	std::vector<unsigned> text_offset;
+	std::vector<int> para;
+	std::vector<unsigned> start;
+	std::vector<const HtmlTagNode *> parent;
+	std::vector<unsigned> child_offset;
+
+	std::vector<const HtmlTagNode *> children;
+
+	// The text of each paragraph containing a link, end to end, and the
+	// offset of each.
+	string para_text;
+	std::vector<unsigned> para_offset;
+
+	// Start a link.  Its text is added by set_text() and its children by
+	// add_child(), before the next link is started.
+	void add(const StringView &target, unsigned start_pos,
+		 const HtmlTagNode * parent_);
+	void set_text(const StringView &text) {
+	    pool.append(text.data(), text.size());
+	}
+	void add_child(const HtmlTagNode * node) { children.push_back(node); }
+
+	// Store the text of a paragraph, returning its index.
+	int add_para(const StringView &text);
+
+	void clear();
+
+	// The end of item i in a column, given the column and the end of the
+	// last item.
+	static unsigned end_of(const std::vector<unsigned> &column, size_t i,
+			       size_t last_end) {
+	    return i + 1 < column.size() ? column[i + 1] : unsigned(last_end);
+	}
+
+    public:
+	class const_iterator {
+	    const HtmlLinkTable * table;
+	    size_t i;
+
+	  public:
+	    const_iterator(const HtmlLinkTable * table_, size_t i_)
+		: table(table_), i(i_) { }
+	    HtmlLink operator*() const { return HtmlLink(table, i); }
+	    const_iterator & operator++() { ++i; return *this; }
+	    bool operator==(const const_iterator &o) const { return i == o.i; }
+	    bool operator!=(const const_iterator &o) const { return i != o.i; }
+	};
+
+	size_t size() const { return target_offset.size(); }
+	bool empty() const { return target_offset.empty(); }
+	HtmlLink operator[](size_t i) const { return HtmlLink(this, i); }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, size()); }
+
+	// The paragraphs containing links.
+	size_t para_count() const { return para_offset.size(); }
+	StringView get_para(size_t j) const {
+	    size_t b = para_offset[j];
+	    return StringView(para_text.data() + b,
+			      end_of(para_offset, j, para_text.size()) - b);
+	}
+};
+
+inline StringView
+HtmlLink::target() const
+{
+    size_t b = table->target_offset[i];
+    return StringView(table->pool.data() + b, table->text_offset[i] - b);
+}
+
+inline StringView
+HtmlLink::text() const
+{
+    size_t b = table->text_offset[i];
+    return StringView(table->pool.data() + b,
+		      HtmlLinkTable::end_of(table->target_offset, i,
+					    table->pool.size()) - b);
+}
+
+inline int
+HtmlLink::para_index() const
+{
+    return table->para[i];
+}
+
+inline StringView
+HtmlLink::para() const
+{
+    int j = table->para[i];
+    return j < 0 ? StringView() : table->get_para(j);
+}
+
+inline unsigned
+HtmlLink::start_pos() const
+{
+    return table->start[i];
+}
+
+inline const HtmlTagNode *
+HtmlLink::parent() const
+{
+    return table->parent[i];
+}
+
+inline size_t
+HtmlLink::child_tag_count() const
+{
+    return HtmlLinkTable::end_of(table->child_offset, i,
+				 table->children.size()) -
+	   table->child_offset[i];
+}
+
+inline const HtmlTag &
+HtmlLink::child_tag(size_t k) const
+{
+    return table->children[table->child_offset[i] + k]->tag;
+}
+
+/** Storage for the HtmlTagNodes of a document.
+ *
+ *  These are the tags on a parser's stack of open tags, and those kept as
+ *  the parents and children of links (HtmlLinkTable holds everything else
+ *  about links).  Tags are handed out from blocks, and all released at once
+ *  by clear().
+ *  Released tags are kept for reuse, along with the memory their strings
+ *  have grown, so parsing one document after another with the same arena
+ *  soon stops allocating memory for them.
+ *
+ *  An arena isn't thread-safe: give each thread its own.  Only one parser
+ *  should use an arena at a time, since its tags are released when the
+ *  parser is destroyed.
+ */
+class HtmlArena {
+	// Each block holds BLOCK_SIZE tags.
+	std::vector<HtmlTagNode *> node_blocks;
+
+	// The number of tags handed out since clear().
+	size_t nodes_used;
+
+	// Tags handed out and then released by release_node().
+	std::vector<HtmlTagNode *> free_nodes;
+
+	HtmlArena(const HtmlArena &);
+	void operator=(const HtmlArena &);
+
+    public:
+	enum { BLOCK_SIZE = 64 };
+
+	HtmlArena() : nodes_used(0) { }
+	~HtmlArena();
+
+	// Return a tag with the given name and parent, and no class or id.
+	HtmlTagNode * new_node(const StringView &name, HtmlTagId tag_id,
+			       HtmlTagNode * parent);
+
+	// Release a tag early, unless it has been kept.
+	void release_node(HtmlTagNode * node) {
+	    if (!node->kept) free_nodes.push_back(node);
+	}
+
+	// Release all the tags handed out.
+	void clear() {
+	    nodes_used = 0;
+	    free_nodes.clear();
+	}
 };
 
-struct HtmlLink {
-    // Target URL of link
-    string target;
+// How MyHtmlParser treats a tag, as a mask of these flags.
+enum {
+    TAG_IS_BLOCK = 1,		// Opening or closing it starts a paragraph.
+    TAG_IS_VOID = 2,		// It has no close tag (like <br>).
+    TAG_IS_RAW_TEXT = 4,	// Its content is skipped (like <script>).
+    TAG_IS_IGNORED = 8		// Its content is skipped if skip_hidden_content
+				// is set (like <noscript>).
+};
 
-    // Text in link
-    string text;
+// The flags for each tag id, looked up with a single load while parsing.
+// All tags which aren't HTML elements share the flags for TAG_UNKNOWN.
+class HtmlTagPolicy {
+	unsigned char flags[TAG_COUNT];
 
-    // Paragraph text containing link
-    string para;
+    public:
+	// The default policy, which follows HTML5.
+	HtmlTagPolicy();
 
-    // Start position of link in paragraph
-    size_t start_pos;
+	unsigned get(HtmlTagId id) const { return flags[id]; }
 
-    // Parent tags of link (and also the link tag itself).
-    std::vector<HtmlTag> parent_tags;
+	void set(HtmlTagId id, unsigned flags_) { flags[id] = flags_; }
 
-    // Child tags, in order of starting (not necessarily nested).
-    std::vector<HtmlTag> child_tags;
+	// Set the flags for the element with the given lowercase name.
+	// Returns false if it isn't an HTML element.
+	bool set(const string & name, unsigned flags_);
+};
+
+// Why MyHtmlParser stopped before the end of a document.
+enum HtmlStopReason {
+    STOP_NONE,		// It didn't.
+    STOP_BODY_END,	// </body> was seen.
+    STOP_NOINDEX,	// A robots meta tag said not to index the document.
+    STOP_HEAD_END	// The end of the head was reached in metadata_only mode.
+};
+
+// Fields which MyHtmlParser can extract, for its fields member.  Unwanted
+// fields are left empty, and the work of finding them is skipped.
+// indexing_allowed and the character set are always found.
+enum {
+    FIELD_CONTENT = 1,		// dump
+    FIELD_TITLE = 2,		// title
+    FIELD_META = 4,		// sample and keywords
+    FIELD_LINKS = 8,		// links, with their target and text
+    FIELD_LINK_CONTEXT = 16,	// para, start_pos and tags for each link
+    FIELD_PARASTARTS = 32,	// parastarts
+    FIELD_ALL = 63
 };
 
 class MyHtmlParser : public HtmlParser {
@@ -73,35 +347,146 @@ class MyHtmlParser : public HtmlParser {
 	bool pending_space;
 	string title, sample, keywords, dump;
 	bool indexing_allowed;
-	std::vector<HtmlLink *> links;
+	HtmlLinkTable links;
 	std::vector<unsigned int> parastarts;
+	HtmlStopReason stop_reason;
+
+	// A mask of the FIELD_* values to extract (FIELD_ALL by default).
+	// Set this before parsing.
+	unsigned fields;
+
+	// If true, only the title and meta tags are extracted, and parsing
+	// stops at the end of the document's head (at <body>, </head>, or
+	// anything which can only appear in the body).  Set this before
+	// parsing.
+	bool metadata_only;
+
+	// If true, the content of <noscript>, <template> and <svg> is skipped
+	// as well as that of <script> and <style>.  Set this before parsing.
+	bool skip_hidden_content;
+
+	// If true, U+00A0 (non-breaking space) and the other Unicode space
+	// separators are collapsed with the whitespace around them, as if they
+	// were spaces.  Set this before parsing.
+	bool collapse_unicode_spaces;
+
+	// Which tags start paragraphs, have no close tag, or have content to
+	// skip.  Change this before parsing.
+	HtmlTagPolicy tag_policy;
+
+	// The most tags which may be open at once (512 by default).  Tags
+	// opened beyond this are treated as if they were closed straight away.
+	unsigned max_depth;
 
     private:
-	std::vector<HtmlTag> tags;
-	std::vector<HtmlLink*> paralinks;
-	HtmlLink * currlink;
+	// Where tags are allocated; own_arena unless one was given.
+	HtmlArena own_arena;
+	HtmlArena * arena;
+
+	// The innermost open tag (NULL if there are none), how many tags are
+	// open, and how many with each id.
+	HtmlTagNode * open_tags;
+	unsigned open_depth;
+	unsigned open_count[TAG_COUNT];
+	void push_tag(HtmlTagNode * node);
+	void close_tags(HtmlTagNode * node);
+	void close_implied_tags(HtmlTagId id);
+
+	// Links waiting for the end of their paragraph.
+	std::vector<size_t> paralinks;
+	// True if a link is open (it's always the last in links).
+	bool in_link;
 	unsigned int parastart;
 	unsigned int link_text_start;
 	void new_para();
 	void start_dump();
+	void end_parse();
+	void start_parse(const char *data, size_t len);
+
+	// Whether text is currently part of the title (in metadata_only mode).
+	bool in_title;
+	bool process_meta(const HtmlAttributes &p);
+	bool head_opening_tag(HtmlTagId id, const HtmlAttributes &p);
+	bool head_closing_tag(HtmlTagId id);
 
     public:
-	void process_text(const string &text);
-	void opening_tag(const string &tag, const map<string,string> &p);
+	void process_undecoded_text(const StringView &text, bool has_amp);
+	bool opening_tag_view(const StringView &tag, HtmlTagId id,
+			      const HtmlAttributes &p);
 	void close_link();
-	void closing_tag(const string &tag);
+	bool closing_tag_view(const StringView &tag, HtmlTagId id);
+	void prescan(const char *p, size_t len, bool bom);
+	void xml_declaration(const string &charset_);
+	bool skip_content(HtmlTagId id) const;
 	void parse_html(const string &text);
 	void parse_html(const string &text, const string &charset_);
+	void parse_html(const char *data, size_t len);
+	void parse_html(const char *data, size_t len, const string &charset_);
+
+	// Parse a file, mapping it into memory rather than reading it where
+	// possible.  Returns false (with errno set) if it can't be read.
+	bool parse_file(const string &path);
+
+	// For parsing a document which arrives in pieces: call fix_charset()
+	// first if the character set is known, then feed() each piece, and
+	// finish() at the end.  To parse another document with the same
+	// parser, call reset() first.
+	void fix_charset(const string &charset_);
+	void finish();
+
+	// Clear the results and state of the last document, keeping the
+	// memory allocated for them, and the options set (such as fields).
+	void reset();
 	MyHtmlParser() :
 		fixed_charset(false),
 		in_script_tag(false),
 		in_style_tag(false),
 		pending_space(false),
 		indexing_allowed(true),
-		currlink(NULL),
+		stop_reason(STOP_NONE),
+		fields(FIELD_ALL),
+		metadata_only(false),
+		skip_hidden_content(false),
+		collapse_unicode_spaces(false),
+		max_depth(512),
+		arena(&own_arena),
+		open_tags(NULL),
+		open_depth(0),
+		in_link(false),
 		parastart(0),
-		link_text_start(0)
+		link_text_start(0),
+		in_title(false)
         {
+	    // Default HTML character set is latin 1.
+	    charset = "ISO-8859-1";
+	    memset(open_count, 0, sizeof(open_count));
+	    start_dump();
+	}
+
+	// Parse with tags allocated from arena, which must outlive the
+	// parser.  This allows the memory to be reused between documents.
+	MyHtmlParser(HtmlArena &arena_) :
+		fixed_charset(false),
+		in_script_tag(false),
+		in_style_tag(false),
+		pending_space(false),
+		indexing_allowed(true),
+		stop_reason(STOP_NONE),
+		fields(FIELD_ALL),
+		metadata_only(false),
+		skip_hidden_content(false),
+		collapse_unicode_spaces(false),
+		max_depth(512),
+		arena(&arena_),
+		open_tags(NULL),
+		open_depth(0),
+		in_link(false),
+		parastart(0),
+		link_text_start(0),
+		in_title(false)
+	{
+	    charset = "ISO-8859-1";
+	    memset(open_count, 0, sizeof(open_count));
 	    start_dump();
 	}
 
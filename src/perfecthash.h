@@ -0,0 +1,40 @@
+/* perfecthash.h: hash function used by the generated lookup tables.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_PERFECTHASH_H
+#define OMEGA_INCLUDED_PERFECTHASH_H
+
+#include <stddef.h>
+
+/** 32 bit FNV-1a, with the offset basis perturbed by seed.
+ *
+ *  This must match perfect_hash() in configutils/perfecthash.py, which
+ *  chooses the seeds stored in the generated tables.
+ */
+inline unsigned
+perfect_hash(unsigned seed, const char *p, size_t len)
+{
+    unsigned h = (2166136261u ^ seed) & 0xffffffffu;
+    for (size_t i = 0; i != len; ++i) {
+	h ^= static_cast<unsigned char>(p[i]);
+	h = (h * 16777619u) & 0xffffffffu;
+    }
+    return h;
+}
+
+#endif // OMEGA_INCLUDED_PERFECTHASH_H
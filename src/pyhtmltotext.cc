@@ -20,8 +20,11 @@
 #include <config.h>
 #include <Python.h>
 #include <stdio.h>
+#include <new>
 #include "structmember.h"
+#include "structseq.h"
 #include "myhtmlparse.h"
+#include "utf8check.h"
 
 /* Python object used to represent a link. */
 typedef struct {
@@ -282,7 +285,7 @@ PyHtmlLink_str(PyHtmlLink * link)
 	Py_INCREF(empty);
 	PyTuple_SET_ITEM(args, 3, empty);
     } else {
-	Py_INCREF(link->para);
+	Py_INCREF(link->start_pos);
 	PyTuple_SET_ITEM(args, 3, link->start_pos);
     }
 
@@ -357,6 +360,8 @@ typedef struct {
     PyObject_HEAD
     PyObject *indexing_allowed;
     PyObject *badly_encoded;
+    PyObject *stop_reason;
+    PyObject *charset;
     PyObject *title;
     PyObject *content;
     PyObject *description;
@@ -370,6 +375,8 @@ ParsedPage_dealloc(ParsedPage * self)
 {
     Py_XDECREF(self->indexing_allowed);
     Py_XDECREF(self->badly_encoded);
+    Py_XDECREF(self->stop_reason);
+    Py_XDECREF(self->charset);
     Py_XDECREF(self->title);
     Py_XDECREF(self->content);
     Py_XDECREF(self->description);
@@ -392,6 +399,9 @@ ParsedPage_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 
 	Py_INCREF(Py_False);
 	self->badly_encoded = Py_False;
+
+	Py_INCREF(Py_None);
+	self->stop_reason = Py_None;
     }
 
     return (PyObject *)self;
@@ -406,6 +416,15 @@ static PyMemberDef ParsedPage_members[] = {
 	offsetof(ParsedPage, badly_encoded), 0,
 	"Boolean flag, set to true if badly encoded data was found in the\n"
 	"page."},
+    {"stop_reason", T_OBJECT_EX,
+	offsetof(ParsedPage, stop_reason), 0,
+	"Why parsing stopped before the end of the document: 'body_end' if\n"
+	"</body> was seen, 'noindex' if a robots meta tag disallowed\n"
+	"indexing, 'head_end' if extract_metadata() reached the end of the\n"
+	"head, or None if the whole document was parsed."},
+    {"charset", T_OBJECT_EX,
+	offsetof(ParsedPage, charset), 0,
+	"The character set the document was decoded from."},
     {"title", T_OBJECT_EX,
 	offsetof(ParsedPage, title), 0,
 	"The title of the document."},
@@ -420,7 +439,9 @@ static PyMemberDef ParsedPage_members[] = {
 	"Keywords for the document (based on meta tags)."},
     {"links", T_OBJECT_EX,
 	offsetof(ParsedPage, links), 0,
-	"Links found in the document (together with associated info)."},
+	"Links found in the document (together with associated info), as a\n"
+	"list of PyHtmlLink objects, or a LinkTable if FIELD_LINK_TABLE was\n"
+	"given."},
     {"parastarts", T_OBJECT_EX,
 	offsetof(ParsedPage, parastarts), 0,
 	"Start positions of paragraphs in the document."},
@@ -546,69 +567,221 @@ ParsedPage_register(PyObject * m)
 
 /* Functions */
 
+/* Decode some UTF-8 produced by the parser, setting *badly_encoded_ptr to
+ * True if any of it is invalid.  Invalid sequences are replaced with U+FFFD
+ * (or removed if drop is true), in place, so Python is only ever given
+ * valid UTF-8 to decode.
+ */
 static PyObject *
-decode_utf8_noting_errors(const std::string & data,
-			  PyObject ** badly_encoded_ptr)
-{
-    PyObject * result;
-    if (*badly_encoded_ptr == Py_False) {
-	result = PyUnicode_Decode(data.data(), data.size(), "UTF-8", "strict");
-	if (result == NULL) {
-	    PyErr_Clear();
-	    Py_XDECREF(*badly_encoded_ptr);
-	    Py_INCREF(Py_True);
-	    *badly_encoded_ptr = Py_True;
-	} else {
-	    return result;
-	}
+decode_utf8_noting_errors(std::string & data,
+			  PyObject ** badly_encoded_ptr,
+			  bool drop = false)
+{
+    if (utf8_repair(data, drop) && *badly_encoded_ptr != Py_True) {
+	Py_XDECREF(*badly_encoded_ptr);
+	Py_INCREF(Py_True);
+	*badly_encoded_ptr = Py_True;
     }
-    result = PyUnicode_Decode(data.data(), data.size(), "UTF-8", "ignore");
-    return result;
+    return PyUnicode_DecodeUTF8(data.data(), data.size(), "strict");
 }
 
+/* Like decode_utf8_noting_errors(), but for text which can't be repaired in
+ * place.  Python replaces each invalid sequence with U+FFFD just as
+ * utf8_repair() would.
+ */
 static PyObject *
-extract(PyObject *self, PyObject *args)
+decode_utf8_view_noting_errors(const StringView & data,
+			       PyObject ** badly_encoded_ptr)
 {
-    ParsedPage * result = NULL;
-    PyObject * arg1 = NULL;
-    PyHtmlLink * link = NULL;
-    PyHtmlTag * tag = NULL;
+    if (utf8_count_invalid(data.data(), data.size()) &&
+	*badly_encoded_ptr != Py_True) {
+	Py_XDECREF(*badly_encoded_ptr);
+	Py_INCREF(Py_True);
+	*badly_encoded_ptr = Py_True;
+    }
+    return PyUnicode_DecodeUTF8(data.data(), data.size(), "replace");
+}
 
-    MyHtmlParser parser;
+/// The name of a reason for stopping, or "" if parsing didn't stop early.
+static const char *
+stop_reason_name(HtmlStopReason reason)
+{
+    switch (reason) {
+	case STOP_BODY_END:
+	    return "body_end";
+	case STOP_NOINDEX:
+	    return "noindex";
+	case STOP_HEAD_END:
+	    return "head_end";
+	default:
+	    return "";
+    }
+}
 
-    if (!PyArg_UnpackTuple(args, "extract", 1, 1, &arg1))
-	return NULL;
+/* Return a new list of PyHtmlTag objects for tags.  The object for each tag
+ * is made once and shared: tag_map holds a borrowed reference to each object
+ * made so far, which stays valid while the lists holding it do.
+ */
+static PyObject *
+tag_list(const std::vector<const HtmlTag *> & tags,
+	 std::map<const HtmlTag *, PyObject *> & tag_map,
+	 PyObject ** badly_encoded_ptr)
+{
+    PyObject * list = PyList_New(tags.size());
+    if (list == NULL) return NULL;
+    for (size_t i = 0; i != tags.size(); ++i) {
+	const HtmlTag * t = tags[i];
+	std::map<const HtmlTag *, PyObject *>::const_iterator found;
+	found = tag_map.find(t);
+	if (found != tag_map.end()) {
+	    Py_INCREF(found->second);
+	    PyList_SET_ITEM(list, i, found->second);
+	    continue;
+	}
 
-    if (PyUnicode_Check(arg1)) {
-	/* Convert to a UTF8 string (return value needs to be DECREFed). */
-	PyObject * utf8 = PyUnicode_AsUTF8String(arg1);
-	if (utf8 == NULL)
-	    goto fail;
+	PyHtmlTag * tag = (PyHtmlTag *) PyHtmlTag_new(&PyHtmlTagType,
+						      NULL, NULL);
+	if (tag == NULL) goto fail;
+	// The list owns tag from here, so it's freed if anything fails.
+	PyList_SET_ITEM(list, i, (PyObject *)tag);
+
+	tag->name = decode_utf8_view_noting_errors(t->name, badly_encoded_ptr);
+	if (tag->name == NULL) goto fail;
+	tag->cls = decode_utf8_view_noting_errors(t->cls, badly_encoded_ptr);
+	if (tag->cls == NULL) goto fail;
+	tag->id = decode_utf8_view_noting_errors(t->id, badly_encoded_ptr);
+	if (tag->id == NULL) goto fail;
+	tag_map[t] = (PyObject *)tag;
+    }
+    return list;
+fail:
+    Py_DECREF(list);
+    return NULL;
+}
 
-	try {
-	    parser.parse_html(std::string(PyString_AS_STRING(utf8),
-					  PyString_GET_SIZE(utf8)),
-			      std::string("UTF-8"));
-	} catch(bool) {
-	} catch(...) {
-	    Py_DECREF(utf8);
-	    throw;
-	}
-	Py_DECREF(utf8);
+/* Asks for links as a LinkTable rather than a list of PyHtmlLink objects.
+ * This only affects the Python module, so it's kept well clear of the
+ * parser's FIELD_* bits.
+ */
+static const unsigned FIELD_LINK_TABLE = 0x10000;
+
+static PyStructSequence_Field link_table_fields[] = {
+    {"targets", "List of the target of each link."},
+    {"texts", "List of the text of each link."},
+    {"paras", "List of the index in paragraphs of the paragraph containing\n"
+	      "each link."},
+    {"start_positions", "List of the start position of each link."},
+    {"paragraphs", "List of the text of each paragraph containing a link."},
+    {NULL}
+};
 
-    } else {
-	const char * buffer = NULL;
-	int buffer_length = 0;
-	if (!PyArg_ParseTuple(args, "s#", &buffer, &buffer_length))
-	{
-	    goto fail;
+static PyStructSequence_Desc link_table_desc = {
+    "htmltotext.LinkTable",
+    "The links in a parsed page, as a list for each of their fields.\n\n"
+    "paras, start_positions and paragraphs are None unless\n"
+    "FIELD_LINK_CONTEXT was asked for.",
+    link_table_fields,
+    5
+};
+
+static PyTypeObject LinkTableType;
+
+/* Return a new list holding the result of decoding each of n strings, which
+ * get(i) returns.
+ */
+template<class Get>
+static PyObject *
+decoded_list(size_t n, Get get, PyObject ** badly_encoded_ptr)
+{
+    PyObject * list = PyList_New(n);
+    if (list == NULL) return NULL;
+    for (size_t i = 0; i != n; ++i) {
+	PyObject * item = decode_utf8_view_noting_errors(get(i),
+							 badly_encoded_ptr);
+	if (item == NULL) {
+	    Py_DECREF(list);
+	    return NULL;
 	}
+	PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
 
-	try {
-	    parser.parse_html(std::string(buffer, buffer_length));
-	} catch(bool) {
+struct GetTarget {
+    const HtmlLinkTable & links;
+    GetTarget(const HtmlLinkTable & links_) : links(links_) { }
+    StringView operator()(size_t i) const { return links[i].target(); }
+};
+
+struct GetText {
+    const HtmlLinkTable & links;
+    GetText(const HtmlLinkTable & links_) : links(links_) { }
+    StringView operator()(size_t i) const { return links[i].text(); }
+};
+
+struct GetPara {
+    const HtmlLinkTable & links;
+    GetPara(const HtmlLinkTable & links_) : links(links_) { }
+    StringView operator()(size_t i) const { return links.get_para(i); }
+};
+
+/* Return a new LinkTable for links. */
+static PyObject *
+link_table(const HtmlLinkTable & links, unsigned fields,
+	   PyObject ** badly_encoded_ptr)
+{
+    size_t n = links.size();
+    PyObject * table = PyStructSequence_New(&LinkTableType);
+    if (table == NULL) return NULL;
+
+    // Each item belongs to table as soon as it's set, so is freed with it.
+    PyObject * item;
+    item = decoded_list(n, GetTarget(links), badly_encoded_ptr);
+    if (item == NULL) goto fail;
+    PyStructSequence_SET_ITEM(table, 0, item);
+    item = decoded_list(n, GetText(links), badly_encoded_ptr);
+    if (item == NULL) goto fail;
+    PyStructSequence_SET_ITEM(table, 1, item);
+
+    if (fields & FIELD_LINK_CONTEXT) {
+	PyObject * paras = PyList_New(n);
+	if (paras == NULL) goto fail;
+	PyStructSequence_SET_ITEM(table, 2, paras);
+	PyObject * starts = PyList_New(n);
+	if (starts == NULL) goto fail;
+	PyStructSequence_SET_ITEM(table, 3, starts);
+	for (size_t i = 0; i != n; ++i) {
+	    item = PyInt_FromLong(links[i].para_index());
+	    if (item == NULL) goto fail;
+	    PyList_SET_ITEM(paras, i, item);
+	    item = PyInt_FromLong(links[i].start_pos());
+	    if (item == NULL) goto fail;
+	    PyList_SET_ITEM(starts, i, item);
+	}
+	item = decoded_list(links.para_count(), GetPara(links),
+			    badly_encoded_ptr);
+	if (item == NULL) goto fail;
+	PyStructSequence_SET_ITEM(table, 4, item);
+    } else {
+	for (int i = 2; i != 5; ++i) {
+	    Py_INCREF(Py_None);
+	    PyStructSequence_SET_ITEM(table, i, Py_None);
 	}
     }
+    return table;
+
+fail:
+    Py_DECREF(table);
+    return NULL;
+}
+
+/// Build a ParsedPage holding the results of a parse.
+static PyObject *
+parsed_page_from_parser(MyHtmlParser & parser, bool as_link_table)
+{
+    ParsedPage * result = NULL;
+    PyHtmlLink * link = NULL;
+    unsigned fields = parser.fields;
 
     result = (ParsedPage*) ParsedPage_new(&ParsedPageType, NULL, NULL);
     if (result == NULL) goto fail;
@@ -621,142 +794,144 @@ extract(PyObject *self, PyObject *args)
 	result->indexing_allowed = Py_False;
     }
 
-    // Set the other members to unicode strings
+    if (parser.stop_reason != STOP_NONE) {
+	Py_XDECREF(result->stop_reason);
+	result->stop_reason = PyString_FromString(
+	    stop_reason_name(parser.stop_reason));
+	if (result->stop_reason == NULL) goto fail;
+    }
+
+    Py_XDECREF(result->charset);
+    result->charset = PyString_FromStringAndSize(parser.get_charset().data(),
+						 parser.get_charset().size());
+    if (result->charset == NULL) goto fail;
+
+    // Set the other members to unicode strings, or None for those which
+    // weren't asked for.
     Py_XDECREF(result->title);
-    result->title = decode_utf8_noting_errors(parser.title,
-					      &(result->badly_encoded));
-    if (result->title == NULL) goto fail;
+    if (fields & FIELD_TITLE) {
+	// The title has always had invalid sequences removed, rather than
+	// replaced.
+	result->title = decode_utf8_noting_errors(parser.title,
+						  &(result->badly_encoded),
+						  true);
+	if (result->title == NULL) goto fail;
+    } else {
+	Py_INCREF(Py_None);
+	result->title = Py_None;
+    }
 
     Py_XDECREF(result->content);
-    result->content = PyUnicode_Decode(parser.dump.data(),
-				       parser.dump.size(),
-				       "UTF-8", "replace");
-    if (result->content == NULL) goto fail;
+    if (fields & FIELD_CONTENT) {
+	result->content = decode_utf8_noting_errors(parser.dump,
+						    &(result->badly_encoded));
+	if (result->content == NULL) goto fail;
+    } else {
+	Py_INCREF(Py_None);
+	result->content = Py_None;
+    }
 
     Py_XDECREF(result->description);
-    result->description = PyUnicode_Decode(parser.sample.data(),
-					   parser.sample.size(),
-					   "UTF-8", "replace");
-    if (result->description == NULL) goto fail;
-
     Py_XDECREF(result->keywords);
-    result->keywords = PyUnicode_Decode(parser.keywords.data(),
-					parser.keywords.size(),
-					"UTF-8", "replace");
-    if (result->keywords == NULL) goto fail;
+    if (fields & FIELD_META) {
+	result->description =
+	    decode_utf8_noting_errors(parser.sample, &(result->badly_encoded));
+	if (result->description == NULL) goto fail;
+
+	result->keywords =
+	    decode_utf8_noting_errors(parser.keywords, &(result->badly_encoded));
+	if (result->keywords == NULL) goto fail;
+    } else {
+	Py_INCREF(Py_None);
+	result->description = Py_None;
+	Py_INCREF(Py_None);
+	result->keywords = Py_None;
+    }
 
     Py_XDECREF(result->links);
-    result->links = PyList_New(parser.links.size());
-    if (result->links == NULL) goto fail;
-    {
-	std::vector<HtmlLink*>::const_iterator i;
-	std::map<std::string, PyObject*> para_map;
-	std::map<std::string, PyObject*> name_map;
-	Py_ssize_t pos = 0;
-	for (i = parser.links.begin(); i != parser.links.end(); ++i, ++pos)
-	{
+    if (!(fields & FIELD_LINKS)) {
+	Py_INCREF(Py_None);
+	result->links = Py_None;
+    } else if (as_link_table) {
+	result->links = link_table(parser.links, fields,
+				   &(result->badly_encoded));
+	if (result->links == NULL) goto fail;
+    } else {
+	result->links = PyList_New(parser.links.size());
+	if (result->links == NULL) goto fail;
+
+	// Links in the same paragraph are next to each other, and share the
+	// object for its text.
+	int last_para_index = -1;
+	PyObject * last_para = NULL;
+	// Links share the objects for the tags they have in common.
+	std::map<const HtmlTag *, PyObject *> tag_map;
+	std::vector<const HtmlTag *> parent_tags, child_tags;
+	for (size_t pos = 0; pos != parser.links.size(); ++pos) {
+	    HtmlLink l = parser.links[pos];
 	    link = (PyHtmlLink *) PyHtmlLink_new(
 		&PyHtmlLinkType, NULL, NULL);
 	    if (link == NULL) goto fail;
-	    link->target = PyUnicode_Decode((*i)->target.data(),
-					    (*i)->target.size(),
-					    "UTF-8", "replace");
+	    link->target = decode_utf8_view_noting_errors(l.target(),
+							  &(result->badly_encoded));
 	    if (link->target == NULL) goto fail;
 
-	    link->text = PyUnicode_Decode((*i)->text.data(),
-					  (*i)->text.size(),
-					  "UTF-8", "replace");
+	    link->text = decode_utf8_view_noting_errors(l.text(),
+							&(result->badly_encoded));
 	    if (link->text == NULL) goto fail;
 
+	    if (fields & FIELD_LINK_CONTEXT) {
+		if (last_para == NULL || l.para_index() != last_para_index) {
+		    link->para = decode_utf8_view_noting_errors(
+			l.para(), &(result->badly_encoded));
+		    if (link->para == NULL) goto fail;
+		    last_para_index = l.para_index();
+		    last_para = link->para;
+		} else {
+		    link->para = last_para;
+		    Py_INCREF(link->para);
+		}
+
+		link->start_pos = PyInt_FromLong(l.start_pos());
+		if (link->start_pos == NULL) goto fail;
 
-	    std::map<std::string, PyObject*>::iterator para_element = para_map.find((*i)->para);
-	    if (para_element == para_map.end()) {
-		link->para = PyUnicode_Decode((*i)->para.data(),
-			  		      (*i)->para.size(),
-					      "UTF-8", "replace");
-		if (link->para == NULL) goto fail;
-		para_map[(*i)->para] = link->para;
-	    } else {
-		link->para = para_element->second;
-		Py_XINCREF(link->para);
-	    }
+		l.get_parent_tags(parent_tags);
+		link->parent_tags = tag_list(parent_tags, tag_map,
+					     &(result->badly_encoded));
+		if (link->parent_tags == NULL) goto fail;
 
-	    link->start_pos = PyInt_FromLong((*i)->start_pos);
-	    if (link->start_pos == NULL) goto fail;
-
-	    /*{
-		Py_XDECREF(link->parent_tags);
-		link->parent_tags = PyList_New((*i)->parent_tags.size());
-		std::vector<HtmlTag>::const_iterator j;
-		Py_ssize_t tagpos = 0;
-		for (j = (*i)->parent_tags.begin(); j != (*i)->parent_tags.end();
-		     ++j, ++tagpos) {
-
-		    tag = (PyHtmlTag *) PyHtmlTag_new(
-			&PyHtmlTagType, NULL, NULL);
-		    if (tag == NULL) goto fail;
-
-		    tag->name = PyUnicode_Decode(j->name.data(),
-						 j->name.size(),
-						 "UTF-8", "replace");
-		    if (tag->name == NULL) goto fail;
-
-		    tag->cls = PyUnicode_Decode(j->cls.data(),
-						j->cls.size(),
-						"UTF-8", "replace");
-		    if (tag->cls == NULL) goto fail;
-
-		    tag->id = PyUnicode_Decode(j->id.data(),
-					       j->id.size(),
-					       "UTF-8", "replace");
-		    if (tag->id == NULL) goto fail;
-
-		    PyList_SET_ITEM(link->parent_tags, tagpos, (PyObject *)tag);
-		    tag = NULL;
+		child_tags.clear();
+		for (size_t j = 0; j != l.child_tag_count(); ++j) {
+		    child_tags.push_back(&l.child_tag(j));
 		}
+		link->child_tags = tag_list(child_tags, tag_map,
+					    &(result->badly_encoded));
+		if (link->child_tags == NULL) goto fail;
+	    } else {
+		Py_INCREF(Py_None);
+		link->para = Py_None;
+		Py_INCREF(Py_None);
+		link->start_pos = Py_None;
+		Py_INCREF(Py_None);
+		link->parent_tags = Py_None;
+		Py_INCREF(Py_None);
+		link->child_tags = Py_None;
 	    }
 
-	    {
-		Py_XDECREF(link->child_tags);
-		link->child_tags = PyList_New((*i)->child_tags.size());
-		std::vector<HtmlTag>::const_iterator j;
-		Py_ssize_t tagpos = 0;
-		for (j = (*i)->child_tags.begin(); j != (*i)->child_tags.end();
-		     ++j, ++tagpos) {
-
-		    tag = (PyHtmlTag *) PyHtmlTag_new(
-			&PyHtmlTagType, NULL, NULL);
-		    if (tag == NULL) goto fail;
-
-		    tag->name = PyUnicode_Decode(j->name.data(),
-						 j->name.size(),
-						 "UTF-8", "replace");
-		    if (tag->name == NULL) goto fail;
-
-		    tag->cls = PyUnicode_Decode(j->cls.data(),
-						j->cls.size(),
-						"UTF-8", "replace");
-		    if (tag->cls == NULL) goto fail;
-
-		    tag->id = PyUnicode_Decode(j->id.data(),
-					       j->id.size(),
-					       "UTF-8", "replace");
-		    if (tag->id == NULL) goto fail;
-
-		    PyList_SET_ITEM(link->child_tags, tagpos, (PyObject *)tag);
-		    tag = NULL;
-		}
-	    }*/
-
 	    PyList_SET_ITEM(result->links, pos, (PyObject *)link);
 	    link = NULL;
 	}
     }
 
     Py_XDECREF(result->parastarts);
-    result->parastarts = PyList_New(parser.parastarts.size());
-    if (result->parastarts == NULL) goto fail;
-    {
+    if (!(fields & FIELD_PARASTARTS)) {
+	Py_INCREF(Py_None);
+	result->parastarts = Py_None;
+    } else {
+	result->parastarts = PyList_New(parser.parastarts.size());
+	if (result->parastarts == NULL) goto fail;
+    }
+    if (fields & FIELD_PARASTARTS) {
 	std::vector<unsigned int>::const_iterator i;
 	Py_ssize_t pos = 0;
 	for (i = parser.parastarts.begin(); i != parser.parastarts.end(); ++i, ++pos)
@@ -771,10 +946,341 @@ extract(PyObject *self, PyObject *args)
 fail:
     Py_XDECREF(result);
     Py_XDECREF(link);
-    Py_XDECREF(tag);
     return NULL;
 }
 
+/* Set fields to the mask of FIELD_* values given by arg.  Returns false,
+ * with a Python exception set, if it isn't an integer or has any other bits
+ * set.
+ */
+static bool
+get_fields(PyObject * arg, unsigned & fields)
+{
+    long value = PyInt_AsLong(arg);
+    if (value == -1 && PyErr_Occurred())
+	return false;
+    if (value < 0 || (value & ~long(FIELD_ALL | FIELD_LINK_TABLE))) {
+	PyErr_Format(PyExc_ValueError, "invalid fields mask: %ld", value);
+	return false;
+    }
+    fields = value;
+    return true;
+}
+
+/* Parse the string or unicode object passed as the first argument of name,
+ * with an optional mask of fields to extract as the second, which is stored
+ * in fields.  Returns false, with a Python exception set, if the arguments
+ * are invalid.
+ */
+static bool
+parse_string_arg(MyHtmlParser & parser, PyObject *args, const char * name,
+		 unsigned & fields)
+{
+    PyObject * arg1 = NULL;
+    PyObject * arg2 = NULL;
+
+    if (!PyArg_UnpackTuple(args, name, 1, 2, &arg1, &arg2))
+	return false;
+
+    if (arg2 != NULL && !get_fields(arg2, fields))
+	return false;
+    // FIELD_LINK_TABLE only matters to the Python objects built afterwards.
+    parser.fields = fields & FIELD_ALL;
+
+    if (PyUnicode_Check(arg1)) {
+	/* Convert to a UTF8 string (return value needs to be DECREFed). */
+	PyObject * utf8 = PyUnicode_AsUTF8String(arg1);
+	if (utf8 == NULL)
+	    return false;
+
+	try {
+	    parser.parse_html(PyString_AS_STRING(utf8),
+			      PyString_GET_SIZE(utf8),
+			      std::string("UTF-8"));
+	} catch(...) {
+	    Py_DECREF(utf8);
+	    throw;
+	}
+	Py_DECREF(utf8);
+
+    } else {
+	const char * buffer = NULL;
+	int buffer_length = 0;
+	if (!PyArg_Parse(arg1, "s#", &buffer, &buffer_length))
+	{
+	    return false;
+	}
+
+	// Parse straight from the string's buffer, rather than a copy.
+	parser.parse_html(buffer, buffer_length);
+    }
+    return true;
+}
+
+// The tags of each document parsed by the module-level functions are
+// allocated here, so the memory is reused from one document to the next.
+// There's only one arena for the whole process, so those functions aren't
+// reentrant: they rely on the GIL being held while parsing, and mustn't be
+// called with it released.  Each Extractor's parser has an arena of its own.
+static HtmlArena arena;
+
+/* Extract from the string passed in args with parser, which may be reused
+ * from an earlier call.
+ */
+static PyObject *
+extract_string_with(MyHtmlParser & parser, PyObject *args, const char * name,
+		    bool metadata_only)
+{
+    unsigned fields = FIELD_ALL;
+    parser.metadata_only = metadata_only;
+
+    if (!parse_string_arg(parser, args, name, fields))
+	return NULL;
+
+    return parsed_page_from_parser(parser, (fields & FIELD_LINK_TABLE) != 0);
+}
+
+static PyObject *
+extract_file_with(MyHtmlParser & parser, PyObject *args)
+{
+    const char * path = NULL;
+    PyObject * arg2 = NULL;
+    unsigned fields = FIELD_ALL;
+
+    if (!PyArg_ParseTuple(args, "s|O", &path, &arg2))
+	return NULL;
+    if (arg2 != NULL && !get_fields(arg2, fields))
+	return NULL;
+    parser.fields = fields & FIELD_ALL;
+    parser.metadata_only = false;
+
+    if (!parser.parse_file(path))
+	return PyErr_SetFromErrnoWithFilename(PyExc_IOError,
+					      const_cast<char *>(path));
+
+    return parsed_page_from_parser(parser, (fields & FIELD_LINK_TABLE) != 0);
+}
+
+static PyObject *
+extract(PyObject *self, PyObject *args)
+{
+    MyHtmlParser parser(arena);
+    return extract_string_with(parser, args, "extract", false);
+}
+
+static PyObject *
+extract_metadata(PyObject *self, PyObject *args)
+{
+    MyHtmlParser parser(arena);
+    return extract_string_with(parser, args, "extract_metadata", true);
+}
+
+static PyObject *
+extract_file(PyObject *self, PyObject *args)
+{
+    MyHtmlParser parser(arena);
+    return extract_file_with(parser, args);
+}
+
+
+/* Python object which keeps a parser (and the arena for its tags) for reuse
+ * between documents. */
+typedef struct {
+    PyObject_HEAD
+    MyHtmlParser *parser;
+} Extractor;
+
+static void
+Extractor_dealloc(Extractor * self)
+{
+    delete self->parser;
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+/* Apply a dict mapping element names to TAG_IS_* flags to policy.  Returns
+ * false, with a Python exception set, if it isn't valid.
+ */
+static bool
+set_tag_policy(HtmlTagPolicy & policy, PyObject * dict)
+{
+    if (!PyDict_Check(dict)) {
+	PyErr_SetString(PyExc_TypeError, "tag_policy must be a dict");
+	return false;
+    }
+    PyObject * key;
+    PyObject * value;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(dict, &pos, &key, &value)) {
+	if (!PyString_Check(key)) {
+	    PyErr_SetString(PyExc_TypeError,
+			    "tag_policy keys must be element names");
+	    return false;
+	}
+	long flags = PyInt_AsLong(value);
+	if (flags == -1 && PyErr_Occurred())
+	    return false;
+	std::string name(PyString_AS_STRING(key), PyString_GET_SIZE(key));
+	if (!policy.set(name, flags)) {
+	    PyErr_Format(PyExc_ValueError, "Unknown element name: %s",
+			 name.c_str());
+	    return false;
+	}
+    }
+    return true;
+}
+
+static PyObject *
+Extractor_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static const char * kwlist[] = {
+	"tag_policy", "skip_hidden_content", "collapse_unicode_spaces", NULL
+    };
+    PyObject * tag_policy = NULL;
+    PyObject * skip_hidden_content = NULL;
+    PyObject * collapse_unicode_spaces = NULL;
+    Extractor *self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OOO:Extractor",
+				     const_cast<char **>(kwlist),
+				     &tag_policy, &skip_hidden_content,
+				     &collapse_unicode_spaces))
+	return NULL;
+
+    self = (Extractor *)type->tp_alloc(type, 0);
+    if (self != NULL) {
+	try {
+	    self->parser = new MyHtmlParser;
+	} catch (const std::bad_alloc &) {
+	    // tp_alloc zeroed parser, so deallocating self is safe.
+	    Py_DECREF(self);
+	    return PyErr_NoMemory();
+	}
+	if (skip_hidden_content) {
+	    int value = PyObject_IsTrue(skip_hidden_content);
+	    if (value < 0) {
+		Py_DECREF(self);
+		return NULL;
+	    }
+	    self->parser->skip_hidden_content = value;
+	}
+	if (collapse_unicode_spaces) {
+	    int value = PyObject_IsTrue(collapse_unicode_spaces);
+	    if (value < 0) {
+		Py_DECREF(self);
+		return NULL;
+	    }
+	    self->parser->collapse_unicode_spaces = value;
+	}
+	if (tag_policy && tag_policy != Py_None &&
+	    !set_tag_policy(self->parser->tag_policy, tag_policy)) {
+	    Py_DECREF(self);
+	    return NULL;
+	}
+    }
+
+    return (PyObject *)self;
+}
+
+static PyObject *
+Extractor_extract(Extractor *self, PyObject *args)
+{
+    return extract_string_with(*self->parser, args, "extract", false);
+}
+
+static PyObject *
+Extractor_extract_metadata(Extractor *self, PyObject *args)
+{
+    return extract_string_with(*self->parser, args, "extract_metadata", true);
+}
+
+static PyObject *
+Extractor_extract_file(Extractor *self, PyObject *args)
+{
+    return extract_file_with(*self->parser, args);
+}
+
+static PyMethodDef Extractor_methods[] = {
+    {"extract", (PyCFunction)Extractor_extract, METH_VARARGS,
+     "Extract text from a string containing some HTML, as extract() does."},
+    {"extract_metadata", (PyCFunction)Extractor_extract_metadata,
+     METH_VARARGS,
+     "Extract the title and meta tags from a string containing HTML, as\n"
+     "extract_metadata() does."},
+    {"extract_file", (PyCFunction)Extractor_extract_file, METH_VARARGS,
+     "Extract text from a file containing some HTML, as extract_file()\n"
+     "does."},
+    {NULL}  /* Sentinel */
+};
+
+static PyTypeObject ExtractorType = {
+    PyObject_HEAD_INIT(NULL)
+    0,                         /*ob_size*/
+    "htmltotext.Extractor",    /*tp_name*/
+    sizeof(Extractor),         /*tp_basicsize*/
+    0,                         /*tp_itemsize*/
+    (destructor)Extractor_dealloc, /*tp_dealloc*/
+    0,                         /*tp_print*/
+    0,                         /*tp_getattr*/
+    0,                         /*tp_setattr*/
+    0,                         /*tp_compare*/
+    0,                         /*tp_repr*/
+    0,                         /*tp_as_number*/
+    0,                         /*tp_as_sequence*/
+    0,                         /*tp_as_mapping*/
+    0,                         /*tp_hash */
+    0,                         /*tp_call*/
+    0,                         /*tp_str*/
+    0,                         /*tp_getattro*/
+    0,                         /*tp_setattro*/
+    0,                         /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE, /*tp_flags*/
+    "Extracts text from a series of HTML documents.\n\n"
+    "This has the same methods as the module, but keeps its parser and the\n"
+    "memory allocated for it between documents, which is faster when\n"
+    "parsing many similar pages.\n\n"
+    "The optional tag_policy argument is a dict mapping lowercase element\n"
+    "names to a combination of TAG_IS_BLOCK (it starts a paragraph),\n"
+    "TAG_IS_VOID (it has no close tag), TAG_IS_RAW_TEXT (its content is\n"
+    "skipped) and TAG_IS_IGNORED (its content is skipped if\n"
+    "skip_hidden_content is true), replacing the default treatment of\n"
+    "those elements.  By default, the content of <noscript>, <template>\n"
+    "and <svg> is ignored in this way.\n\n"
+    "If collapse_unicode_spaces is true, U+00A0 (non-breaking space) and\n"
+    "the other Unicode space separators are collapsed with the whitespace\n"
+    "around them, as if they were spaces.", /* tp_doc */
+    0,		               /* tp_traverse */
+    0,		               /* tp_clear */
+    0,		               /* tp_richcompare */
+    0,		               /* tp_weaklistoffset */
+    0,		               /* tp_iter */
+    0,		               /* tp_iternext */
+    Extractor_methods,         /* tp_methods */
+    0,                         /* tp_members */
+    0,                         /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,                         /* tp_init */
+    0,                         /* tp_alloc */
+    Extractor_new,             /* tp_new */
+};
+
+static void
+Extractor_ready()
+{
+    if (PyType_Ready(&ExtractorType) < 0)
+	return;
+}
+
+static void
+Extractor_register(PyObject * m)
+{
+    Py_INCREF(&ExtractorType);
+    PyModule_AddObject(m, "Extractor", (PyObject *)&ExtractorType);
+}
+
 static PyMethodDef HtmlToTextMethods[] = {
     {"extract", extract, METH_VARARGS,
      "Extract text from a string containing some HTML.\n\n"
@@ -787,8 +1293,35 @@ static PyMethodDef HtmlToTextMethods[] = {
      "default of the Latin-1 (ISO-8859-1) being assumed (since this is the\n"
      "standard (but deprecated) default for HTML).  The badly_encoded\n"
      "member of the resulting ParsedPage object will be set to True if any\n"
-     "invalid character encodings are found, but a best effort to ignore\n"
-     "such errors and continue will be made."
+     "invalid character encodings are found in any of its fields, but a\n"
+     "best effort to ignore such errors and continue will be made: invalid\n"
+     "sequences are removed from the title, and replaced by U+FFFD\n"
+     "elsewhere.\n\n"
+     "An optional second argument gives the fields to extract, as a\n"
+     "combination of FIELD_CONTENT, FIELD_TITLE, FIELD_META (description\n"
+     "and keywords), FIELD_LINKS, FIELD_LINK_CONTEXT (each link's para,\n"
+     "start_pos, parent_tags and child_tags) and FIELD_PARASTARTS; the\n"
+     "default is FIELD_ALL.  Fields which aren't asked for are None, and\n"
+     "aren't worked out at all.  Adding FIELD_LINK_TABLE gives the links\n"
+     "as a LinkTable, with a list for each field, which is much quicker to\n"
+     "build when there are many links (but has no tags).  ValueError is\n"
+     "raised if any other bits are set."
+    },
+    {"extract_metadata", extract_metadata, METH_VARARGS,
+     "Extract just the title and meta tags from a string containing HTML.\n\n"
+     "This takes the same argument as extract(), and returns a ParsedPage\n"
+     "object, but parsing stops at the end of the document's head (at\n"
+     "<body>, </head>, or anything which can only appear in the body), so\n"
+     "this is much faster for large pages.  The content, links and\n"
+     "parastarts members are always empty."
+    },
+    {"extract_file", extract_file, METH_VARARGS,
+     "Extract text from a file containing some HTML.\n\n"
+     "This takes a single argument, the path of the file.  The file is\n"
+     "mapped into memory and parsed in place where possible, rather than\n"
+     "being read into a string first.  Otherwise this behaves like\n"
+     "extract() given a string object, including taking an optional mask\n"
+     "of fields to extract.  IOError is raised if the file can't be read."
     },
     {NULL, NULL, 0, NULL}
 };
@@ -801,6 +1334,7 @@ inithtmltotext(void)
     PyHtmlTag_ready();
     PyHtmlLink_ready();
     ParsedPage_ready();
+    Extractor_ready();
 
     m = Py_InitModule3("htmltotext", HtmlToTextMethods,
 		       "Extract text from HTML documents.");
@@ -808,4 +1342,22 @@ inithtmltotext(void)
     PyHtmlTag_register(m);
     PyHtmlLink_register(m);
     ParsedPage_register(m);
+    Extractor_register(m);
+
+    PyModule_AddIntConstant(m, "FIELD_CONTENT", FIELD_CONTENT);
+    PyModule_AddIntConstant(m, "FIELD_TITLE", FIELD_TITLE);
+    PyModule_AddIntConstant(m, "FIELD_META", FIELD_META);
+    PyModule_AddIntConstant(m, "FIELD_LINKS", FIELD_LINKS);
+    PyModule_AddIntConstant(m, "FIELD_LINK_CONTEXT", FIELD_LINK_CONTEXT);
+    PyModule_AddIntConstant(m, "FIELD_PARASTARTS", FIELD_PARASTARTS);
+    PyModule_AddIntConstant(m, "FIELD_ALL", FIELD_ALL);
+    PyModule_AddIntConstant(m, "FIELD_LINK_TABLE", FIELD_LINK_TABLE);
+    PyModule_AddIntConstant(m, "TAG_IS_BLOCK", TAG_IS_BLOCK);
+    PyModule_AddIntConstant(m, "TAG_IS_VOID", TAG_IS_VOID);
+    PyModule_AddIntConstant(m, "TAG_IS_RAW_TEXT", TAG_IS_RAW_TEXT);
+    PyModule_AddIntConstant(m, "TAG_IS_IGNORED", TAG_IS_IGNORED);
+
+    PyStructSequence_InitType(&LinkTableType, &link_table_desc);
+    Py_INCREF(&LinkTableType);
+    PyModule_AddObject(m, "LinkTable", (PyObject *)&LinkTableType);
 }
@@ -0,0 +1,231 @@
+/* sniffcharset.cc: find the character set of an HTML document.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#include <config.h>
+
+#include "sniffcharset.h"
+
+#include <ctype.h>
+#include <string.h>
+#include "strcasecmp.h"
+
+using namespace std;
+
+size_t
+utf8_bom_length(const char *p, size_t len)
+{
+    if (len >= 3 && memcmp(p, "\xef\xbb\xbf", 3) == 0) return 3;
+    return 0;
+}
+
+inline static bool
+is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\f' || ch == '\r';
+}
+
+inline static bool
+starts_with_nocase(const char *p, const char *end, const char *lower)
+{
+    size_t len = strlen(lower);
+    return size_t(end - p) >= len && strncasecmp(p, lower, len) == 0;
+}
+
+/* Read the next attribute of a tag, as the HTML5 prescan does, lowercasing
+ * the name and value.  Returns false at the end of the tag, or if the
+ * attribute runs past end.
+ */
+static bool
+get_attribute(const char *&p, const char *end, string &name, string &value)
+{
+    name.resize(0);
+    value.resize(0);
+    while (p != end && (is_space(*p) || *p == '/')) ++p;
+    if (p == end || *p == '>') return false;
+
+    while (true) {
+	if (p == end) return false;
+	char ch = *p;
+	if (ch == '=' && !name.empty()) break;
+	if (is_space(ch) || ch == '/' || ch == '>') break;
+	name += tolower(static_cast<unsigned char>(ch));
+	++p;
+    }
+    while (p != end && is_space(*p)) ++p;
+    if (p == end) return false;
+    if (*p != '=') return true;
+    ++p;
+    while (p != end && is_space(*p)) ++p;
+    if (p == end) return false;
+
+    char quote = *p;
+    if (quote == '"' || quote == '\'') {
+	const char * q = static_cast<const char *>(memchr(p + 1, quote, end - p - 1));
+	if (q == NULL) return false;
+	for (++p; p != q; ++p) value += tolower(static_cast<unsigned char>(*p));
+	++p;
+	return true;
+    }
+    if (quote == '>') return true;
+    while (p != end && !is_space(*p) && *p != '>') {
+	value += tolower(static_cast<unsigned char>(*p));
+	++p;
+    }
+    return p != end;
+}
+
+/* Extract the charset from the content attribute of a meta tag, as in
+ * "text/html; charset=utf-8".
+ */
+static bool
+charset_from_content(const string &content, string &charset)
+{
+    string::size_type i = 0;
+    while (true) {
+	i = content.find("charset", i);
+	if (i == string::npos) return false;
+	i += 7;
+	while (i < content.size() && is_space(content[i])) ++i;
+	if (i < content.size() && content[i] == '=') break;
+    }
+    ++i;
+    while (i < content.size() && is_space(content[i])) ++i;
+    if (i == content.size()) return false;
+    char quote = content[i];
+    string::size_type j;
+    if (quote == '"' || quote == '\'') {
+	j = content.find(quote, ++i);
+	if (j == string::npos) return false;
+    } else {
+	j = i;
+	while (j < content.size() && !is_space(content[j]) && content[j] != ';')
+	    ++j;
+    }
+    if (j == i) return false;
+    charset.assign(content, i, j - i);
+    return true;
+}
+
+/* Check a meta tag, with p just after "<meta".  Returns true and sets
+ * charset if it declares one.
+ */
+static bool
+check_meta(const char *&p, const char *end, string &charset)
+{
+    string name, value;
+    // The attributes seen so far (only the first of each counts).
+    bool seen_http_equiv = false, seen_content = false, seen_charset = false;
+    bool got_pragma = false;
+    // -1 if there's no charset yet, 1 if it came from content (and so
+    // needs http-equiv="content-type"), 0 if from a charset attribute.
+    int need_pragma = -1;
+    string found;
+    while (get_attribute(p, end, name, value)) {
+	if (name == "http-equiv") {
+	    if (seen_http_equiv) continue;
+	    seen_http_equiv = true;
+	    if (value == "content-type") got_pragma = true;
+	} else if (name == "content") {
+	    if (seen_content) continue;
+	    seen_content = true;
+	    if (need_pragma == -1 && charset_from_content(value, found))
+		need_pragma = 1;
+	} else if (name == "charset") {
+	    if (seen_charset) continue;
+	    seen_charset = true;
+	    found = value;
+	    need_pragma = 0;
+	}
+    }
+    if (need_pragma == -1 || (need_pragma == 1 && !got_pragma)) return false;
+    if (found.empty()) return false;
+    // A document declaring itself to be UTF-16 can't actually be, if we
+    // could read the declaration as ASCII.
+    if (found.compare(0, 6, "utf-16") == 0) found = "utf-8";
+    charset = found;
+    return true;
+}
+
+/* Check for an XML declaration's encoding, e.g.:
+ * <?xml version="1.0" encoding="UTF-8"?>
+ */
+static bool
+check_xml_declaration(const char *p, const char *end, string &charset)
+{
+    if (end - p < 6 || memcmp(p, "<?xml", 5) != 0 || !is_space(p[5]))
+	return false;
+    const char * decl_end = static_cast<const char *>(memchr(p, '>', end - p));
+    if (decl_end == NULL) return false;
+    string decl(p + 5, decl_end);
+    string::size_type i = decl.find("encoding");
+    if (i == string::npos) return false;
+    i = decl.find_first_not_of(" \t\r\n", i + 8);
+    if (i == string::npos || decl[i] != '=') return false;
+    i = decl.find_first_not_of(" \t\r\n", i + 1);
+    if (i == string::npos || (decl[i] != '"' && decl[i] != '\'')) return false;
+    string::size_type j = decl.find(decl[i], i + 1);
+    if (j == string::npos || j == i + 1) return false;
+    charset.assign(decl, i + 1, j - i - 1);
+    return true;
+}
+
+bool
+sniff_charset(const char *p, size_t len, string &charset)
+{
+    if (len > SNIFF_CHARSET_BYTES) len = SNIFF_CHARSET_BYTES;
+    const char * const end = p + len;
+
+    if (check_xml_declaration(p, end, charset)) return true;
+
+    string name, value;
+    while (p != end) {
+	p = static_cast<const char *>(memchr(p, '<', end - p));
+	if (p == NULL) break;
+	if (starts_with_nocase(p, end, "<!--")) {
+	    // The "--" of "<!--" may also start the "-->".
+	    p += 2;
+	    while (true) {
+		p = static_cast<const char *>(memchr(p, '-', end - p));
+		if (p == NULL) return false;
+		if (end - p < 3) return false;
+		if (p[1] == '-' && p[2] == '>') break;
+		++p;
+	    }
+	    p += 3;
+	} else if (starts_with_nocase(p, end, "<meta") && end - p > 5 &&
+		   (is_space(p[5]) || p[5] == '/')) {
+	    p += 6;
+	    if (check_meta(p, end, charset)) return true;
+	} else if (end - p > 1 && (isalpha(static_cast<unsigned char>(p[1])) ||
+		   (p[1] == '/' && end - p > 2 &&
+		    isalpha(static_cast<unsigned char>(p[2]))))) {
+	    // Skip the tag's name and attributes.
+	    while (p != end && !is_space(*p) && *p != '>') ++p;
+	    while (get_attribute(p, end, name, value)) { }
+	    if (p != end) ++p;
+	} else if (end - p > 1 &&
+		   (p[1] == '!' || p[1] == '/' || p[1] == '?')) {
+	    p = static_cast<const char *>(memchr(p, '>', end - p));
+	    if (p == NULL) break;
+	    ++p;
+	} else {
+	    ++p;
+	}
+    }
+    return false;
+}
@@ -0,0 +1,45 @@
+/* sniffcharset.h: find the character set of an HTML document.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_SNIFFCHARSET_H
+#define OMEGA_INCLUDED_SNIFFCHARSET_H
+
+#include <string>
+
+/// How much of a document sniff_charset() looks at.
+#define SNIFF_CHARSET_BYTES 1024
+
+/** Return the length of a UTF-8 byte order mark at p (3, or 0 if none).
+ *
+ *  UTF-16 byte order marks aren't recognised, since the parser can only
+ *  handle character sets which are supersets of ASCII.
+ */
+size_t utf8_bom_length(const char *p, size_t len);
+
+/** Look for a character set declaration near the start of a document.
+ *
+ *  This follows the HTML5 "prescan" of the first SNIFF_CHARSET_BYTES
+ *  bytes, finding <meta charset=...>, <meta http-equiv="Content-Type"
+ *  content="...; charset=...">, or an XML declaration's encoding, while
+ *  skipping comments and the attributes of other tags.
+ *
+ *  Returns true and sets charset if a declaration is found.
+ */
+bool sniff_charset(const char *p, size_t len, std::string &charset);
+
+#endif // OMEGA_INCLUDED_SNIFFCHARSET_H
@@ -0,0 +1,85 @@
+/* stringview.h: non-owning reference to a run of bytes.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_STRINGVIEW_H
+#define OMEGA_INCLUDED_STRINGVIEW_H
+
+#include <string>
+#include <string.h>
+
+/** A pointer and length referring to bytes owned by someone else.
+ *
+ *  The parser hands these to its callbacks so that text, tag names and
+ *  attributes don't need copying unless the callback wants to keep them.
+ *  A StringView is only valid until the callback returns.
+ */
+class StringView {
+    const char * p;
+    size_t n;
+
+  public:
+    static const size_t npos = size_t(-1);
+
+    StringView() : p(""), n(0) { }
+    StringView(const char * p_, size_t n_) : p(p_), n(n_) { }
+    StringView(const char * s) : p(s), n(strlen(s)) { }
+    StringView(const std::string & s) : p(s.data()), n(s.size()) { }
+
+    const char * data() const { return p; }
+    size_t size() const { return n; }
+    size_t length() const { return n; }
+    bool empty() const { return n == 0; }
+
+    const char * begin() const { return p; }
+    const char * end() const { return p + n; }
+
+    char operator[](size_t i) const { return p[i]; }
+
+    std::string str() const { return std::string(p, n); }
+
+    StringView substr(size_t pos, size_t len = npos) const {
+	if (len > n - pos) len = n - pos;
+	return StringView(p + pos, len);
+    }
+
+    size_t find_first_of(const char * chars, size_t pos = 0) const {
+	for (; pos < n; ++pos)
+	    if (p[pos] && strchr(chars, p[pos])) return pos;
+	return npos;
+    }
+
+    size_t find_first_not_of(const char * chars, size_t pos = 0) const {
+	for (; pos < n; ++pos)
+	    if (!p[pos] || !strchr(chars, p[pos])) return pos;
+	return npos;
+    }
+};
+
+inline bool
+operator==(const StringView & a, const StringView & b)
+{
+    return a.size() == b.size() && memcmp(a.data(), b.data(), a.size()) == 0;
+}
+
+inline bool
+operator!=(const StringView & a, const StringView & b)
+{
+    return !(a == b);
+}
+
+#endif // OMEGA_INCLUDED_STRINGVIEW_H
@@ -0,0 +1,120 @@
+/* utf8check.cc: find and repair invalid UTF-8.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#include <config.h>
+
+#include "utf8check.h"
+
+#include "charscan.h"
+
+using namespace std;
+
+/* Check the sequence starting with the non-ASCII byte at s, with avail
+ * bytes available.  Returns the length of the sequence if it's valid, or
+ * minus the number of bytes making up the invalid sequence.
+ *
+ * This follows Python 2's decoder, which (unlike the Unicode standard's
+ * recommendation) allows encoded surrogates, treats a truncated sequence
+ * at the end as a single error, and never takes more than three bytes as
+ * one invalid sequence otherwise.
+ */
+static inline int
+check_sequence(const unsigned char *s, size_t avail)
+{
+    unsigned char c = s[0];
+    int n = (c < 0xc2) ? 0 : (c < 0xe0) ? 2 : (c < 0xf0) ? 3 : (c < 0xf5) ? 4 : 0;
+    if (n == 0) return -1;
+
+    if (size_t(n) > avail) {
+	// Truncated: the lead byte and any continuation bytes after it.
+	int k = 1;
+	while (size_t(k) < avail && (s[k] & 0xc0) == 0x80) ++k;
+	return -k;
+    }
+
+    if ((s[1] & 0xc0) != 0x80) return -1;
+    switch (n) {
+	case 2:
+	    return 2;
+	case 3:
+	    if ((s[2] & 0xc0) != 0x80 || (c == 0xe0 && s[1] < 0xa0))
+		return -2;
+	    return 3;
+	default:
+	    if ((s[2] & 0xc0) != 0x80 || (s[3] & 0xc0) != 0x80 ||
+		(c == 0xf0 && s[1] < 0x90) || (c == 0xf4 && s[1] > 0x8f))
+		return ((s[2] & 0xc0) == 0x80) ? -3 : -2;
+	    return 4;
+    }
+}
+
+size_t
+utf8_count_invalid(const char *p, size_t len, vector<size_t> *offsets)
+{
+    const char * const begin = p;
+    const char * const end = p + len;
+    size_t count = 0;
+    while (true) {
+	// Skip ASCII a block at a time.
+	p = charscan(p, end, ScanNonAscii());
+	if (p == end) break;
+	// Then check sequences one at a time until we're back to ASCII.
+	while (p != end && (*p & 0x80)) {
+	    int n = check_sequence(reinterpret_cast<const unsigned char *>(p),
+				   end - p);
+	    if (n < 0) {
+		if (offsets) offsets->push_back(p - begin);
+		++count;
+		n = -n;
+	    }
+	    p += n;
+	}
+    }
+    return count;
+}
+
+size_t
+utf8_repair(string &s, bool drop)
+{
+    size_t count = utf8_count_invalid(s.data(), s.size());
+    if (count == 0) return 0;
+
+    string out;
+    out.reserve(s.size() + (drop ? 0 : count * 2));
+    const char * p = s.data();
+    const char * const end = p + s.size();
+    while (p != end) {
+	const char * q = charscan(p, end, ScanNonAscii());
+	while (q != end && (*q & 0x80)) {
+	    int n = check_sequence(reinterpret_cast<const unsigned char *>(q),
+				   end - q);
+	    if (n > 0) {
+		q += n;
+		continue;
+	    }
+	    out.append(p, q - p);
+	    if (!drop) out.append("\xef\xbf\xbd", 3);
+	    q -= n;
+	    p = q;
+	}
+	out.append(p, q - p);
+	p = q;
+    }
+    swap(s, out);
+    return count;
+}
@@ -0,0 +1,47 @@
+/* utf8check.h: find and repair invalid UTF-8.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef OMEGA_INCLUDED_UTF8CHECK_H
+#define OMEGA_INCLUDED_UTF8CHECK_H
+
+#include <string>
+#include <vector>
+
+/** Count the invalid sequences in some UTF-8.
+ *
+ *  Invalid sequences are split up the way Python's UTF-8 decoder splits
+ *  them, so each would become one U+FFFD when decoding with "replace".
+ *
+ *  @param p, len	The text to check.
+ *  @param offsets	If not NULL, the offset of each invalid sequence is
+ *			appended to this.
+ *
+ *  Returns the number of invalid sequences (0 if the text is valid).
+ */
+size_t utf8_count_invalid(const char *p, size_t len,
+			  std::vector<size_t> *offsets = NULL);
+
+/** Repair invalid UTF-8.
+ *
+ *  Each invalid sequence (as counted by utf8_count_invalid()) is replaced
+ *  by U+FFFD, or removed if drop is true.  Returns the number of invalid
+ *  sequences found; s is left untouched if there are none.
+ */
+size_t utf8_repair(std::string &s, bool drop = false);
+
+#endif // OMEGA_INCLUDED_UTF8CHECK_H
@@ -24,79 +24,156 @@
 #include <algorithm>
 #include <string>
 
+#include "charscan.h"
 #include "safeerrno.h"
 #ifdef USE_ICONV
 # include <iconv.h>
-#else
-# include <xapian.h>
 #endif
+#include <string.h>
 #include "strcasecmp.h"
 
 using namespace std;
 
-void
-convert_to_utf8(string & text, const string & charset)
+bool
+charset_needs_conversion(const string & charset)
 {
     // Shortcut if it's already in utf8!
     if (charset.size() == 5 && strcasecmp(charset.c_str(), "utf-8") == 0)
-	return;
+	return false;
     if (charset.size() == 4 && strcasecmp(charset.c_str(), "utf8") == 0)
-	return;
+	return false;
 
     // Nobody has told us what charset it's in, so do as little work as
     // possible!
     if (charset.empty())
+	return false;
+
+    return true;
+}
+
+/// Append the UTF-8 form of [p, p + len) in a single-byte charset to out.
+static void
+convert_single_byte(const SingleByteTable & table, const char * p, size_t len,
+		    string & out)
+{
+    // Each byte becomes at most three, so make room for the worst case and
+    // trim afterwards.
+    size_t old_size = out.size();
+    out.resize(old_size + len * 3);
+    char * o = &out[old_size];
+    const char * end = p + len;
+    while (p != end) {
+	// Copy runs of ASCII as they are.
+	const char * q = charscan(p, end, ScanNonAscii());
+	memcpy(o, p, q - p);
+	o += q - p;
+	p = q;
+
+	// Then expand bytes one at a time until the next block, since other
+	// bytes tend to be close together.
+	const char * block_end = (end - p > 16) ? p + 16 : end;
+	while (p != block_end) {
+	    unsigned char ch = *p++;
+	    if (ch < 0x80) {
+		*o++ = ch;
+		continue;
+	    }
+	    const unsigned char * e = table[ch & 0x7f];
+	    memcpy(o, e + 1, 3);
+	    o += e[0];
+	}
+    }
+    out.resize(o - out.data());
+}
+
+Utf8Converter::Utf8Converter()
+    : active_(false), table(NULL)
+#ifdef USE_ICONV
+      , conv(NULL)
+#endif
+{
+}
+
+Utf8Converter::~Utf8Converter()
+{
+#ifdef USE_ICONV
+    map<string, void *>::const_iterator i;
+    for (i = descriptors.begin(); i != descriptors.end(); ++i) {
+	if (i->second) (void)iconv_close((iconv_t)i->second);
+    }
+#endif
+}
+
+void
+Utf8Converter::set_charset(const string & charset_)
+{
+    if (charset_ == charset) return;
+    charset = charset_;
+    active_ = false;
+    table = NULL;
+    if (!charset_needs_conversion(charset)) return;
+
+    table = single_byte_charset(charset.data(), charset.size());
+    if (table) {
+	active_ = true;
 	return;
+    }
 
-    char buf[1024];
+#ifdef USE_ICONV
+    map<string, void *>::iterator i = descriptors.find(charset);
+    if (i == descriptors.end()) {
+	iconv_t cd = iconv_open("UTF-8", charset.c_str());
+	// Remember failures too, so we don't keep trying to open them.
+	void * d = (cd == (iconv_t)-1) ? NULL : (void *)cd;
+	i = descriptors.insert(make_pair(charset, d)).first;
+    }
+    conv = i->second;
+    active_ = (conv != NULL);
+    reset();
+#endif
+}
 
+void
+Utf8Converter::reset()
+{
 #ifdef USE_ICONV
-    iconv_t conv = iconv_open("UTF-8", charset.c_str());
-    if (conv == (iconv_t)-1) return;
+    if (conv && !table) (void)iconv((iconv_t)conv, NULL, NULL, NULL, NULL);
+#endif
+}
 
-    string tmp;
+void
+Utf8Converter::convert(const char * p, size_t len, string & out)
+{
+    if (!active_) {
+	out.append(p, len);
+	return;
+    }
+
+    if (table) {
+	convert_single_byte(*table, p, len, out);
+	return;
+    }
 
-    ICONV_INPUT_TYPE in = const_cast<char *>(text.c_str());
-    size_t in_len = text.size();
+#ifdef USE_ICONV
+    char buf[1024];
+    ICONV_INPUT_TYPE in = const_cast<char *>(p);
+    size_t in_len = len;
     while (in_len) {
-	char * out = buf;
+	char * o = buf;
 	size_t out_len = sizeof(buf);
-	if (iconv(conv, &in, &in_len, &out, &out_len) == size_t(-1) &&
-	    errno != E2BIG) {
-	    // FIXME: how to handle this?
+	size_t r = iconv((iconv_t)conv, &in, &in_len, &o, &out_len);
+	out.append(buf, o - buf);
+	if (r != size_t(-1) || errno == E2BIG) continue;
+	// Replace an invalid byte with U+FFFD and carry on after it, as
+	// utf8_repair() does for invalid UTF-8.  An incomplete sequence at the
+	// end is replaced the same way.
+	out.append("\xef\xbf\xbd", 3);
+	if (errno == EILSEQ) {
+	    ++in;
+	    --in_len;
+	} else {
 	    break;
 	}
-	tmp.append(buf, out - buf);
-    }
-
-    (void)iconv_close(conv);
-#else
-    /* If we don't have iconv, handle iso-8859-1. */
-    const char * p = charset.c_str();
-    if (strncasecmp(p, "iso", 3) == 0) {
-	p += 3;
-	if (*p == '-' || *p == '_') ++p;
-    }
-    if (strncmp(p, "8859", 4) != 0) return;
-    p += 4;
-    if (*p == '-' || *p == '_') ++p;
-    if (strcmp(p, "1") != 0) return;
-
-    // FIXME: pull this out as a standard "normalise utf-8" function?
-    string tmp;
-    tmp.reserve(text.size());
-
-    size_t start = 0;
-    for (string::const_iterator i = text.begin(); i != text.end(); ++i) {
-	unsigned ch = static_cast<unsigned char>(*i);
-	start += Xapian::Unicode::to_utf8(ch, buf + start);
-	if (start >= sizeof(buf) - 4) {
-	    tmp.append(buf, start);
-	    start = 0;
-	}
     }
-    if (start) tmp.append(buf, start);
 #endif
-
-    swap(text, tmp);
 }
@@ -20,8 +20,67 @@
 #ifndef OMEGA_INCLUDED_UTF8CONVERT_H
 #define OMEGA_INCLUDED_UTF8CONVERT_H
 
+#include <map>
 #include <string>
 
-void convert_to_utf8(std::string & text, const std::string & charset);
+#include "charsettables.h"
+
+/// Return false if text in charset is already UTF-8 (or of unknown charset).
+bool charset_needs_conversion(const std::string & charset);
+
+/** Convert text to UTF-8, a piece at a time.
+ *
+ *  Common single-byte character sets are converted with built-in tables
+ *  (see charsettables.h), and anything else with iconv if it's available.
+ *  When iconv is used, the descriptor for each character set is opened the
+ *  first time it's needed and kept until the converter is destroyed, so
+ *  switching back and forth between character sets, or converting many
+ *  documents with the same converter, doesn't reopen them.  Shift state is
+ *  kept between calls to convert(), so a document can be passed in pieces.
+ */
+class Utf8Converter {
+	std::string charset;
+
+	// True if convert() changes the text.
+	bool active_;
+
+	// The table for charset, if it's a single-byte character set.
+	const SingleByteTable * table;
+
+#ifdef USE_ICONV
+	// The descriptor for charset, and those for every character set seen
+	// so far (including any which failed to open).
+	void * conv;
+	std::map<std::string, void *> descriptors;
+#endif
+
+	// Not copyable.
+	Utf8Converter(const Utf8Converter &);
+	void operator=(const Utf8Converter &);
+
+    public:
+	Utf8Converter();
+	~Utf8Converter();
+
+	/** Set the character set to convert from.
+	 *
+	 *  This is cheap if the character set is unchanged.  Otherwise the
+	 *  converter is reset to its initial shift state.
+	 */
+	void set_charset(const std::string & charset_);
+
+	/// Reset to the initial shift state, ready for a new document.
+	void reset();
+
+	/** Return false if convert() would copy text unchanged.
+	 *
+	 *  This is the case for UTF-8, and for character sets which can't be
+	 *  converted (which are left as they are).
+	 */
+	bool active() const { return active_; }
+
+	/// Append the UTF-8 form of [p, p + len) to out.
+	void convert(const char * p, size_t len, std::string & out);
+};
 
 #endif // OMEGA_INCLUDED_UTF8CONVERT_H
@@ -21,12 +21,15 @@
 
 #include "xmlparse.h"
 
-void
-XmlParser::opening_tag(const string &, const map<string,string> &)
+bool
+XmlParser::opening_tag_view(const StringView &, HtmlTagId,
+			    const HtmlAttributes &)
 {
+    return true;
 }
 
-void
-XmlParser::closing_tag(const string &)
+bool
+XmlParser::closing_tag_view(const StringView &, HtmlTagId)
 {
+    return true;
 }
@@ -25,8 +25,11 @@
 class XmlParser : public MyHtmlParser {
   public:
     XmlParser() : MyHtmlParser() { }
-    void opening_tag(const string &tag, const map<string,string> &p);
-    void closing_tag(const string &tag);
+    bool opening_tag_view(const StringView &tag, HtmlTagId id,
+			  const HtmlAttributes &p);
+    bool closing_tag_view(const StringView &tag, HtmlTagId id);
+    // XML has no raw text elements.
+    bool skip_content(HtmlTagId) const { return false; }
 };
 
 #endif // OMEGA_INCLUDED_XMLPARSE_H
@@ -19,6 +19,8 @@ r"""test.py: Test htmltotext module.
 
 """
 
+import os
+import tempfile
 import unittest
 import htmltotext
 
@@ -41,6 +43,24 @@ class TestHtmlToText(unittest.TestCase):
         html = '<title>foo\xa3</title>'
         self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
 
+    def test_single_byte_charsets(self):
+        """Test the built-in single-byte character set tables.
+
+        Pages labelled as Latin-1 are decoded as Windows-1252, as browsers do.
+
+        """
+        html = '<title>\x93caf\xe9\x94 \x81</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'\u201ccaf\xe9\u201d \x81')
+        html = '<meta http-equiv="content-type" content="text/html; charset=KOI8-R"/><title>\xd2\xc1\xc4</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'\u0440\u0430\u0434')
+        html = '<meta http-equiv="content-type" content="charset=iso-8859-3"/><title>a\xa5b</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'a\ufffdb')
+        # Only unassigned bytes below 0xa0 map to C1 controls.
+        html = '<meta charset=windows-1253><title>a\xd2b</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'a\ufffdb')
+        html = '<meta charset=windows-1255><title>a\xcab</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'a\u05bab')
+
     def test_unicode_input(self):
         """Test supplying a unicode string as input.
 
@@ -66,6 +86,20 @@ class TestHtmlToText(unittest.TestCase):
         self.assertEqual(htmltotext.extract(html).title, u'foo')
         self.assertEqual(htmltotext.extract(html).badly_encoded, True)
 
+    def test_badly_encoded_content(self):
+        """Test that invalid UTF-8 outside the title is noted and replaced.
+
+        """
+        html = '<meta http-equiv="content-type" content="charset=utf-8"/><title>ok</title><body>a\xe2\x82b\xff <a href="x\xc0">c</a></body>'
+        parsed = htmltotext.extract(html)
+        self.assertEqual(parsed.title, u'ok')
+        self.assertEqual(parsed.content, u'a\ufffdb\ufffd c\n')
+        self.assertEqual(parsed.links[0].target, u'x\ufffd')
+        self.assertEqual(parsed.badly_encoded, True)
+        # Bytes which can't be converted from other charsets are replaced too.
+        html = '<meta charset="shift_jis"><title>a\x82\xa0\xff\x82\xa0z\x82</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'a\u3042\ufffd\u3042z\ufffd')
+
     def test_meta_description(self):
         """Test supplying a meta description tag.
 
@@ -153,6 +187,33 @@ class TestHtmlToText(unittest.TestCase):
         self.assertEqual([t.name for t in parsed.links[0].parent_tags], ['body', 'div', 'a'])
         self.assertEqual([t.name for t in parsed.links[1].parent_tags], ['body', 'a'])
         self.assertEqual([t.name for t in parsed.links[2].parent_tags], ['body', 'a'])
+        self.assertTrue(parsed.links[1].parent_tags[0] is parsed.links[2].parent_tags[0])
+
+    def test_implied_end_tags(self):
+        """Test that tags with optional end tags are closed as HTML says.
+
+        """
+        parsed = htmltotext.extract('<body><p>foo <a href="1">x</a><p>bar <a href="2">y</a>'
+                                    '<ul><li><a href="3">z</a><li><p><a href="4">w</a></ul>'
+                                    '<table><tr><td>1<td><a href="5">v</a><tr><td><a href="6">u</a></table>')
+        self.assertEqual([[t.name for t in link.parent_tags] for link in parsed.links], [
+            ['body', 'p', 'a'],
+            ['body', 'p', 'a'],
+            ['body', 'ul', 'li', 'a'],
+            ['body', 'ul', 'li', 'p', 'a'],
+            ['body', 'table', 'tr', 'td', 'a'],
+            ['body', 'table', 'tr', 'td', 'a'],
+        ])
+        # A paragraph doesn't end a link inside an earlier one.
+        parsed = htmltotext.extract('<p><a href="1">x<p>y</a>z')
+        self.assertEqual(parsed.links[0].text, u'x\ny')
+        # A stray close tag is ignored.
+        parsed = htmltotext.extract('<div><a href="1">x</span></em>y</a></div>')
+        self.assertEqual(parsed.links[0].text, u'xy')
+        # Tags nested too deeply aren't kept, but a link among them still
+        # gets its text.
+        parsed = htmltotext.extract('<div>' * 1000 + '<a href="1">x')
+        self.assertEqual(parsed.links[0].text, u'x\n')
 
     def test_entity_decode(self):
         """Tests decoding of entities"""
@@ -160,6 +221,275 @@ class TestHtmlToText(unittest.TestCase):
         parsed = htmltotext.extract(html)
         self.assertEqual(u'This \xa0 \xa0 has some extra spaces. and has "quotes"\n', parsed.content)
 
+    def test_numeric_entities(self):
+        """Test numeric references which are out of range or whitespace.
+
+        """
+        html = '<body>a&#32;&#x9; b&#99999999999999999999;&#xD800;c&#0;d</body>'
+        parsed = htmltotext.extract(html)
+        self.assertEqual(u'a b\ufffd\ufffdcd\n', parsed.content)
+
+    def test_named_entities(self):
+        """Test HTML5 named references, and text which only looks like one.
+
+        """
+        html = '<body>&hellip; &copy 2010 AT&T &NotEqualTilde; &notit; &amp &#;x</body>'
+        parsed = htmltotext.extract(html)
+        self.assertEqual(u'\u2026 \xa9 2010 AT&T \u2242\u0338 \xacit; & &#;x\n', parsed.content)
+
+    def test_extract_file(self):
+        """Test extracting from a file, and from an empty file.
+
+        """
+        html = '<meta http-equiv="content-type" content="charset=utf8"/><title>foo\xc2\xa3</title><body>Hello  World</body>'
+        fd, path = tempfile.mkstemp(suffix='.html')
+        try:
+            os.write(fd, html)
+            os.close(fd)
+            parsed = htmltotext.extract_file(path)
+            self.assertEqual(parsed.title, u'foo\xa3')
+            self.assertEqual(parsed.content, htmltotext.extract(html).content)
+            open(path, 'w').close()
+            self.assertEqual(htmltotext.extract_file(path).content, u'')
+        finally:
+            os.unlink(path)
+        self.assertRaises(IOError, htmltotext.extract_file, path)
+
+    def test_charset_prescan(self):
+        """Test that a byte order mark or early charset declaration is used.
+
+        """
+        html = '\xef\xbb\xbf<title>foo\xc2\xa3</title><body>x</body>'
+        self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
+        html = '<meta charset=utf-8><title>foo\xc2\xa3</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
+        html = '<title>foo\xc2\xa3</title><meta http-equiv="Content-Type" content="text/html; charset=utf-8">'
+        self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
+        # The byte order mark wins over a declaration.
+        html = '\xef\xbb\xbf<meta charset=iso-8859-1><title>foo\xc2\xa3</title>'
+        self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
+        # A <meta charset> is only looked for in the first 1024 bytes.
+        html = '<title>foo\xa3</title>' + ' ' * 1024 + '<meta charset=utf-8>'
+        self.assertEqual(htmltotext.extract(html).title, u'foo\xa3')
+        # An XML declaration is used, but a byte order mark or the
+        # character set of unicode input wins over it.
+        html = '<?xml version="1.0" encoding="iso-8859-1"?><html><body>caf\xe9</body></html>'
+        self.assertEqual(htmltotext.extract(html).content, u'caf\xe9\n')
+        html = '\xef\xbb\xbf<?xml version="1.0" encoding="iso-8859-1"?><html><body>caf\xc3\xa9</body></html>'
+        self.assertEqual(htmltotext.extract(html).content, u'caf\xe9\n')
+        html = u'<?xml version="1.0" encoding="iso-8859-1"?><html><body>caf\xe9</body></html>'
+        self.assertEqual(htmltotext.extract(html).content, u'caf\xe9\n')
+        # An encoding with no closing quote is ignored.
+        html = '<?xml version="1.0" encoding="iso-8859-1 ?><html><body>caf\xc3\xa9</body></html>'
+        self.assertEqual(htmltotext.extract(html).content, u'caf\xe9\n')
+
+    def test_stop_reason(self):
+        """Test that the reason parsing stopped early is reported.
+
+        """
+        parsed = htmltotext.extract('<body>foo</body>bar')
+        self.assertEqual(parsed.content, u'foo\n')
+        self.assertEqual(parsed.stop_reason, 'body_end')
+        parsed = htmltotext.extract('<meta name="robots" content="noindex"><body>foo')
+        self.assertEqual(parsed.stop_reason, 'noindex')
+        self.assertEqual(htmltotext.extract('<body>foo').stop_reason, None)
+
+    def test_extract_metadata(self):
+        """Test extracting only the title and meta tags.
+
+        """
+        html = '<html><head><title>foo &amp; bar</title><meta name="description" content="desc"><meta name="keywords" content="kw"><meta http-equiv="content-type" content="text/html; charset=utf-8"></head><body><p>body <a href="x">link</a></body></html>'
+        parsed = htmltotext.extract_metadata(html)
+        self.assertEqual(parsed.title, u'foo & bar')
+        self.assertEqual(parsed.description, u'desc')
+        self.assertEqual(parsed.keywords, u'kw')
+        self.assertEqual(parsed.charset, 'utf-8')
+        self.assertEqual(parsed.indexing_allowed, True)
+        self.assertEqual(parsed.stop_reason, 'head_end')
+        self.assertEqual(parsed.content, u'')
+        self.assertEqual(parsed.links, [])
+        self.assertEqual(parsed.parastarts, [])
+        # Body content with no <body> tag ends the head too.
+        parsed = htmltotext.extract_metadata('<title>t</title>text<meta name="keywords" content="kw">')
+        self.assertEqual(parsed.title, u't')
+        self.assertEqual(parsed.keywords, u'')
+        parsed = htmltotext.extract_metadata('<title>t</title><div><meta name="keywords" content="kw">')
+        self.assertEqual(parsed.keywords, u'')
+        parsed = htmltotext.extract_metadata(u'<meta name="robots" content="noindex"><title>t</title>')
+        self.assertEqual(parsed.indexing_allowed, False)
+        self.assertEqual(parsed.stop_reason, 'noindex')
+        self.assertEqual(parsed.charset, 'UTF-8')
+
+    def test_fields(self):
+        """Test extracting only some fields.
+
+        """
+        html = '<title>t</title><meta name="keywords" content="kw"><body><p>foo <a href="x">bar</a></p></body>'
+        full = htmltotext.extract(html)
+        parsed = htmltotext.extract(html, htmltotext.FIELD_CONTENT)
+        self.assertEqual(parsed.content, full.content)
+        self.assertEqual(parsed.title, None)
+        self.assertEqual(parsed.keywords, None)
+        self.assertEqual(parsed.links, None)
+        self.assertEqual(parsed.parastarts, None)
+        parsed = htmltotext.extract(html, htmltotext.FIELD_TITLE | htmltotext.FIELD_META)
+        self.assertEqual(parsed.title, u't')
+        self.assertEqual(parsed.keywords, u'kw')
+        self.assertEqual(parsed.content, None)
+        parsed = htmltotext.extract(html, htmltotext.FIELD_LINKS)
+        self.assertEqual(parsed.links[0].target, u'x')
+        self.assertEqual(parsed.links[0].text, full.links[0].text)
+        self.assertEqual(parsed.links[0].para, None)
+        self.assertEqual(parsed.links[0].parent_tags, None)
+        parsed = htmltotext.extract(html, htmltotext.FIELD_LINKS | htmltotext.FIELD_LINK_CONTEXT)
+        self.assertEqual(parsed.links[0].para, full.links[0].para)
+        self.assertEqual(parsed.links[0].start_pos, full.links[0].start_pos)
+        self.assertEqual([t.name for t in parsed.links[0].parent_tags], ['body', 'p', 'a'])
+        self.assertRaises(ValueError, htmltotext.extract, html, 0x100)
+        self.assertRaises(ValueError, htmltotext.extract, html, -1)
+        self.assertRaises(ValueError, htmltotext.extract_file, __file__, 1 << 40)
+        self.assertRaises(TypeError, htmltotext.extract, html, 'x')
+        # A robots meta tag is obeyed whatever fields are asked for.
+        html = '<html><head><meta name="robots" content="noindex"></head><body>secret text</body></html>'
+        parsed = htmltotext.extract(html, htmltotext.FIELD_CONTENT)
+        self.assertEqual(parsed.indexing_allowed, False)
+        self.assertEqual(parsed.stop_reason, 'noindex')
+        self.assertEqual(parsed.content, u'')
+
+    def test_script_content(self):
+        """Test that markup inside script and style elements is ignored.
+
+        """
+        parsed = htmltotext.extract('<body><script>if (a<b) x = "</p></body><!--";</script>'
+                                    '<p>foo<style>p:after { content: "<a href=x>" }</STYLE >bar</body>')
+        self.assertEqual(parsed.content, u'foobar\n')
+        self.assertEqual(parsed.links, [])
+        self.assertEqual(parsed.stop_reason, 'body_end')
+        parsed = htmltotext.extract('<script>x</scripts></script/>foo')
+        self.assertEqual(parsed.content, u'foo\n')
+
+    def test_extractor(self):
+        """Test that an Extractor can be reused for several documents.
+
+        """
+        extractor = htmltotext.Extractor()
+        first = extractor.extract('<title>One</title><body><p>foo <a href="x">bar</a>'
+                                  '<meta name="robots" content="noindex">')
+        self.assertEqual(first.title, u'One')
+        self.assertEqual(first.indexing_allowed, False)
+        second = extractor.extract('<meta charset="utf-8"><body>\xc2\xa3')
+        self.assertEqual(second.title, u'')
+        self.assertEqual(second.content, u'\xa3\n')
+        self.assertEqual(second.links, [])
+        self.assertEqual(second.indexing_allowed, True)
+        self.assertEqual(second.stop_reason, None)
+        self.assertEqual(first.links[0].target, u'x')
+        self.assertEqual(extractor.extract_metadata('<title>Three</title><p>x').title, u'Three')
+        html = '<title>t</title><body><p>a <a href="y">b</a> c</p><p>d'
+        self.assertEqual(str(extractor.extract(html).links[0]),
+                         str(htmltotext.extract(html).links[0]))
+        self.assertEqual(extractor.extract(html, htmltotext.FIELD_TITLE).content, None)
+        self.assertEqual(extractor.extract(html).content, htmltotext.extract(html).content)
+
+    def test_extractor_charsets(self):
+        """Test that an Extractor converts each document from its own
+        character set, starting in the initial shift state.
+
+        """
+        extractor = htmltotext.Extractor()
+        # This leaves ISO-2022-JP shifted into JIS X 0208.
+        parsed = extractor.extract('<meta charset="iso-2022-jp"><title>\x1b$B$3</title>')
+        self.assertEqual(parsed.title, u'\u3053')
+        parsed = extractor.extract('<meta charset="iso-2022-jp"><title>abc</title>')
+        self.assertEqual(parsed.title, u'abc')
+        parsed = extractor.extract('<meta charset="shift_jis"><title>\x82\xa0</title>')
+        self.assertEqual(parsed.title, u'\u3042')
+        parsed = extractor.extract('<meta charset="koi8-r"><title>\xd2\xc1\xc4</title>')
+        self.assertEqual(parsed.title, u'\u0440\u0430\u0434')
+        parsed = extractor.extract('<meta charset="euc-jp"><title>\xa4\xa2</title>')
+        self.assertEqual(parsed.title, u'\u3042')
+        parsed = extractor.extract('<title>caf\xe9</title>')
+        self.assertEqual(parsed.title, u'caf\xe9')
+
+    def test_tag_policy(self):
+        """Test the treatment of block, void and hidden elements.
+
+        """
+        html = '<body><section>foo</section><nav>bar</nav><noscript>baz</noscript><span>qux</span>'
+        self.assertEqual(htmltotext.extract(html).content, u'foo\n\nbar\nbazqux\n')
+        extractor = htmltotext.Extractor(skip_hidden_content=True)
+        self.assertEqual(extractor.extract(html).content, u'foo\n\nbar\nqux\n')
+        extractor = htmltotext.Extractor(tag_policy={
+            'nav': 0,
+            'span': htmltotext.TAG_IS_BLOCK,
+            'section': htmltotext.TAG_IS_RAW_TEXT,
+        })
+        self.assertEqual(extractor.extract(html).content, u'barbaz\nqux\n\n')
+        # A void element doesn't contain what follows it.
+        html = '<body><p>x<img><a href="y">z</a>'
+        self.assertEqual([t.name for t in htmltotext.extract(html).links[0].parent_tags], ['body', 'p', 'a'])
+        extractor = htmltotext.Extractor(tag_policy={'img': 0})
+        self.assertEqual([t.name for t in extractor.extract(html).links[0].parent_tags], ['body', 'p', 'img', 'a'])
+        self.assertRaises(ValueError, htmltotext.Extractor, tag_policy={'foo': 0})
+        self.assertRaises(TypeError, htmltotext.Extractor, tag_policy=['p'])
+
+        class Bad(object):
+            def __nonzero__(self):
+                raise ZeroDivisionError
+        self.assertRaises(ZeroDivisionError, htmltotext.Extractor, skip_hidden_content=Bad())
+        self.assertRaises(ZeroDivisionError, htmltotext.Extractor, collapse_unicode_spaces=Bad())
+
+    def test_unicode_spaces(self):
+        """Test collapsing non-breaking and other Unicode spaces.
+
+        """
+        html = '<meta charset="utf-8"><title>a&nbsp; b</title><body>x \xc2\xa0y\xe2\x80\x83&#x2009;z\xe3\x80\x80 \xe2\x80\x8b\xe2\x82\xac\xc2\xa3'
+        parsed = htmltotext.extract(html)
+        self.assertEqual(parsed.title, u'a\xa0 b')
+        self.assertEqual(parsed.content, u'x \xa0y\u2003\u2009z\u3000 \u200b\u20ac\xa3\n')
+        extractor = htmltotext.Extractor(collapse_unicode_spaces=True)
+        parsed = extractor.extract(html)
+        self.assertEqual(parsed.title, u'a b')
+        # U+200B (zero width space) isn't a space separator.
+        self.assertEqual(parsed.content, u'x y z \u200b\u20ac\xa3\n')
+        parsed = extractor.extract('<body>\xa0foo\xa0\xa0bar\xa0<a href="x">\xa0baz\xa0</a>')
+        self.assertEqual(parsed.content, u'foo bar baz\n')
+        self.assertEqual(parsed.links[0].text, u'baz')
+        # A truncated sequence isn't mistaken for a space.
+        parsed = extractor.extract('<meta charset="utf-8"><body>a\xe2\x80&amp;b\xe2\x80')
+        self.assertEqual(parsed.content, u'a\ufffd&b\ufffd\n')
+
+    def test_link_para(self):
+        """Test that links in the same paragraph share its text.
+
+        """
+        parsed = htmltotext.extract('<p><a href="1">a</a> and <a href="2">b</a></p>'
+                                    '<p><a href="3"></a></p><p><a href="4"></a>\xe9')
+        links = parsed.links
+        self.assertEqual(links[0].para, u'a and b\n')
+        self.assertTrue(links[0].para is links[1].para)
+        self.assertEqual(links[2].para, u'\n')
+        self.assertEqual(links[3].para, u'\xe9\n')
+        self.assertEqual(parsed.badly_encoded, False)
+        parsed = htmltotext.extract('<meta charset="utf-8"><p><a href="1">a</a>\xff</p>')
+        self.assertEqual(parsed.links[0].para, u'a\ufffd\n')
+        self.assertEqual(parsed.badly_encoded, True)
+
+    def test_link_table(self):
+        """Test extracting links as a table of columns.
+
+        """
+        html = '<p><a href="1">a</a> and <a href="2">b</a></p><p>x <a href="/\xc3\xa9">c</a>'
+        table = htmltotext.extract(html, htmltotext.FIELD_LINKS | htmltotext.FIELD_LINK_TABLE).links
+        self.assertEqual(table.targets, [u'1', u'2', u'/\xe9'])
+        self.assertEqual(table.texts, [u'a', u'b', u'c'])
+        self.assertEqual(table.paras, None)
+        table = htmltotext.extract(html, htmltotext.FIELD_ALL | htmltotext.FIELD_LINK_TABLE).links
+        self.assertEqual(table.paras, [0, 0, 1])
+        self.assertEqual(table.paragraphs, [u'a and b\n', u'x c\n'])
+        links = htmltotext.extract(html).links
+        self.assertEqual(table.start_positions, [l.start_pos for l in links])
+
 def suite():
     return unittest.makeSuite(TestHtmlToText)
 